@@ -0,0 +1,117 @@
+// Compares the scalar vertex transformation (Mat44::transform()) with the SIMD structure of arrays variant
+// (Vec4Soa). Prints the throughput in vertices/s and the maximum deviation of the SIMD results in ULP. Without
+// FMA contraction the results are expected to be bit identical (0 ULP), with FMA contraction the deviation must
+// not exceed MAX_ULP.
+
+#include "math/Mat44.hpp"
+#include "math/Vec4Soa.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+static constexpr std::size_t BLOCK_SIZE { 32 };
+static constexpr std::size_t BLOCK_COUNT { 1024 };
+static constexpr std::size_t VERTEX_COUNT { BLOCK_SIZE * BLOCK_COUNT };
+static constexpr std::size_t ITERATIONS { 200 };
+static constexpr int64_t MAX_ULP { 4 };
+
+static int64_t ulpDistance(const float a, const float b)
+{
+    int32_t ia;
+    int32_t ib;
+    std::memcpy(&ia, &a, sizeof(ia));
+    std::memcpy(&ib, &b, sizeof(ib));
+    // Map the sign magnitude representation to a monotonic integer line
+    const int64_t la = (ia < 0) ? (static_cast<int64_t>(INT32_MIN) - ia) : ia;
+    const int64_t lb = (ib < 0) ? (static_cast<int64_t>(INT32_MIN) - ib) : ib;
+    return std::llabs(la - lb);
+}
+
+#if !defined(__GNUC__)
+static void* volatile escapedBuffer { nullptr };
+#endif
+
+// Compiler barrier: The compiler must assume that the buffer is read and written here. Otherwise it could hoist
+// the loop invariant transformation out of the iteration loop or drop the iterations which are overwritten.
+static void clobber(void* buffer)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "r"(buffer) : "memory");
+#else
+    escapedBuffer = buffer;
+#endif
+}
+
+int main()
+{
+    std::mt19937 gen { 1234 };
+    std::uniform_real_distribution<float> dist { -10.0f, 10.0f };
+
+    rr::Mat44 m;
+    for (std::size_t i = 0; i < 4; i++)
+    {
+        for (std::size_t j = 0; j < 4; j++)
+        {
+            m[i][j] = dist(gen);
+        }
+    }
+
+    std::vector<rr::Vec4> src(VERTEX_COUNT);
+    for (rr::Vec4& v : src)
+    {
+        v = rr::Vec4 { dist(gen), dist(gen), dist(gen), 1.0f };
+    }
+
+    std::vector<rr::Vec4> scalar(VERTEX_COUNT);
+    const auto scalarStart = std::chrono::steady_clock::now();
+    for (std::size_t it = 0; it < ITERATIONS; it++)
+    {
+        clobber(src.data());
+        for (std::size_t i = 0; i < VERTEX_COUNT; i++)
+        {
+            scalar[i] = m.transform(src[i]);
+        }
+        clobber(scalar.data());
+    }
+    const auto scalarEnd = std::chrono::steady_clock::now();
+
+    std::vector<rr::Vec4Soa<BLOCK_SIZE>> soa(BLOCK_COUNT);
+    const auto soaStart = std::chrono::steady_clock::now();
+    for (std::size_t it = 0; it < ITERATIONS; it++)
+    {
+        clobber(src.data());
+        for (std::size_t b = 0; b < BLOCK_COUNT; b++)
+        {
+            for (std::size_t i = 0; i < BLOCK_SIZE; i++)
+            {
+                soa[b].set(i, src[(b * BLOCK_SIZE) + i]);
+            }
+            soa[b].transform(m, BLOCK_SIZE);
+        }
+        clobber(soa.data());
+    }
+    const auto soaEnd = std::chrono::steady_clock::now();
+
+    int64_t maxUlp = 0;
+    for (std::size_t i = 0; i < VERTEX_COUNT; i++)
+    {
+        const rr::Vec4 v = soa[i / BLOCK_SIZE].get(i % BLOCK_SIZE);
+        for (std::size_t c = 0; c < 4; c++)
+        {
+            maxUlp = (std::max)(maxUlp, ulpDistance(v[c], scalar[i][c]));
+        }
+    }
+
+    const double vertices = static_cast<double>(VERTEX_COUNT * ITERATIONS);
+    const double scalarTime = std::chrono::duration<double>(scalarEnd - scalarStart).count();
+    const double soaTime = std::chrono::duration<double>(soaEnd - soaStart).count();
+    printf("SIMD lanes:    %zu\n", rr::Vec4Soa<BLOCK_SIZE>::LANES);
+    printf("scalar:        %.1f Mvertices/s\n", vertices / scalarTime / 1e6);
+    printf("SoA:           %.1f Mvertices/s\n", vertices / soaTime / 1e6);
+    printf("max deviation: %lld ULP (bound %lld)\n", static_cast<long long>(maxUlp), static_cast<long long>(MAX_ULP));
+    return (maxUlp <= MAX_ULP) ? 0 : 1;
+}
@@ -1,5 +1,5 @@
 #include "DMAProxyBusConnector.hpp"
-#include "MultiThreadRunner.hpp"
+#include "PersistentThreadRunner.hpp"
 #include "RIXGL.hpp"
 #include "gl.h"
 #include "glu.h"
@@ -37,6 +37,6 @@ private:
     static constexpr uint32_t RESOLUTION_H = 600;
     static constexpr uint32_t RESOLUTION_W = 1024;
     rr::DMAProxyBusConnector m_busConnector {};
-    rr::MultiThreadRunner m_runner {};
+    rr::PersistentThreadRunner m_runner {};
     Scene m_scene {};
 };
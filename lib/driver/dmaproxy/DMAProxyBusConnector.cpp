@@ -4,6 +4,7 @@
 #include <cstring>
 #include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <pthread.h>
 #include <sched.h>
 #include <signal.h>
@@ -61,10 +62,34 @@ void DMAProxyBusConnector::writeData(const uint8_t index, const uint32_t size)
 
 bool DMAProxyBusConnector::clearToSend()
 {
+    return waitClearToSend(std::chrono::milliseconds { 0 });
+}
+
+bool DMAProxyBusConnector::waitClearToSend(const std::chrono::milliseconds timeout)
+{
+    if (m_busyBufferId == INVALID_BUFFER)
+        return true;
+    // The proxy signals POLLOUT when the last transfer has completed. This blocks the thread in the kernel
+    // till the DMA interrupt arrives instead of polling the device.
+    struct pollfd pfd { m_txChannel.fd, POLLOUT, 0 };
+    const int ret = poll(&pfd, 1, static_cast<int>(timeout.count()));
+    if (ret < 0)
+    {
+        SPDLOG_ERROR("Poll on DMA proxy device failed: {}", strerror(errno));
+    }
+    else if (ret == 0)
+    {
+        return false;
+    }
     waitForDma();
     return true;
 }
 
+int DMAProxyBusConnector::getClearToSendFd() const
+{
+    return m_txChannel.fd;
+}
+
 tcb::span<uint8_t> DMAProxyBusConnector::requestBuffer(const uint8_t index)
 {
     if (index >= BUFFER_COUNT)
@@ -33,6 +33,8 @@ public:
 
     virtual void writeData(const uint8_t index, const uint32_t size) override;
     virtual bool clearToSend() override;
+    virtual bool waitClearToSend(const std::chrono::milliseconds timeout) override;
+    virtual int getClearToSendFd() const override;
     virtual tcb::span<uint8_t> requestBuffer(const uint8_t index) override;
     virtual uint8_t getBufferCount() const override;
 
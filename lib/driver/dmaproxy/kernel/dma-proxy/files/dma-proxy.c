@@ -114,6 +114,7 @@
 #include <linux/module.h>
 #include <linux/of_dma.h>
 #include <linux/platform_device.h>
+#include <linux/poll.h>
 #include <linux/slab.h>
 #include <linux/uaccess.h>
 #include <linux/version.h>
@@ -140,6 +141,7 @@ module_param(internal_test, int, S_IRUGO);
 struct proxy_bd
 {
     struct completion cmp;
+    wait_queue_head_t* wait_queue_p;
     dma_cookie_t cookie;
     dma_addr_t dma_handle;
     struct scatterlist sglist;
@@ -160,6 +162,7 @@ struct dma_proxy_channel
     struct dma_chan* channel_p; /* dma support */
     u32 direction; /* DMA_MEM_TO_DEV or DMA_DEV_TO_MEM */
     int bdindex;
+    wait_queue_head_t wait_queue; /* poll support */
 };
 
 struct dma_proxy
@@ -175,12 +178,15 @@ static int total_count;
 /* Handle a callback and indicate the DMA transfer is complete to another
  * thread of control
  */
-static void sync_callback(void* completion)
+static void sync_callback(void* bd)
 {
+    struct proxy_bd* bd_p = (struct proxy_bd*)bd;
+
     /* Indicate the DMA transaction completed to allow the other
-     * thread of control to finish processing
+     * thread of control to finish processing, also wake up the pollers
      */
-    complete(completion);
+    complete(&bd_p->cmp);
+    wake_up_interruptible(bd_p->wait_queue_p);
 }
 
 /* Prepare a DMA buffer to be used in a DMA transaction, submit it to the DMA engine
@@ -211,7 +217,8 @@ static void start_transfer(struct dma_proxy_channel* pchannel_p)
     else
     {
         chan_desc->callback = sync_callback;
-        chan_desc->callback_param = &pchannel_p->bdtable[bdindex].cmp;
+        chan_desc->callback_param = &pchannel_p->bdtable[bdindex];
+        pchannel_p->bdtable[bdindex].wait_queue_p = &pchannel_p->wait_queue;
 
         /* Initialize the completion for the transfer and before using it
          * then submit the transaction to the DMA engine so that it's queued
@@ -245,6 +252,12 @@ static void wait_for_transfer(struct dma_proxy_channel* pchannel_p)
     /* Wait for the transaction to complete, or timeout, or get an error
      */
     timeout = wait_for_completion_timeout(&pchannel_p->bdtable[bdindex].cmp, timeout);
+    if (timeout != 0)
+    {
+        /* Keep the finished buffer reported as complete to poll
+         */
+        complete(&pchannel_p->bdtable[bdindex].cmp);
+    }
     status = dma_async_is_tx_complete(pchannel_p->channel_p, pchannel_p->bdtable[bdindex].cookie, NULL, NULL);
 
     if (timeout == 0)
@@ -396,12 +409,26 @@ static long ioctl(struct file* file, unsigned int cmd, unsigned long arg)
     return 0;
 }
 
+/* Report the channel as writable when the last started transfer is complete. This allows user space
+ * to wait for the transfer with poll() or select() and a timeout, before it finishes it with FINISH_XFER.
+ */
+static __poll_t local_poll(struct file* file, poll_table* wait)
+{
+    struct dma_proxy_channel* pchannel_p = (struct dma_proxy_channel*)file->private_data;
+
+    poll_wait(file, &pchannel_p->wait_queue, wait);
+    if (completion_done(&pchannel_p->bdtable[pchannel_p->bdindex].cmp))
+        return EPOLLOUT | EPOLLWRNORM;
+    return 0;
+}
+
 static struct file_operations dm_fops = {
     .owner = THIS_MODULE,
     .open = local_open,
     .release = release,
     .unlocked_ioctl = ioctl,
-    .mmap = mmap
+    .mmap = mmap,
+    .poll = local_poll
 };
 
 static char* mem_devnode(struct device* dev, umode_t* mode)
@@ -515,6 +542,8 @@ static int create_channel(struct platform_device* pdev, struct dma_proxy_channel
 {
     int rc, bd;
 
+    init_waitqueue_head(&pchannel_p->wait_queue);
+
     /* Request the DMA channel from the DMA engine and then use the device from
      * the channel for the proxy channel also.
      */
@@ -550,8 +579,16 @@ static int create_channel(struct platform_device* pdev, struct dma_proxy_channel
      * address of each buffer is ready to use later.
      */
     for (bd = 0; bd < BUFFER_COUNT; bd++)
+    {
         pchannel_p->bdtable[bd].dma_handle = (dma_addr_t)(pchannel_p->buffer_phys_addr + (sizeof(struct channel_buffer) * bd) + offsetof(struct channel_buffer, buffer));
 
+        /* A buffer without a transfer is reported as complete by poll
+         */
+        init_completion(&pchannel_p->bdtable[bd].cmp);
+        complete(&pchannel_p->bdtable[bd].cmp);
+        pchannel_p->bdtable[bd].wait_queue_p = &pchannel_p->wait_queue;
+    }
+
     /* The buffer descriptor index into the channel buffers should be specified in each
      * ioctl but we will initialize it to be safe.
      */
@@ -17,6 +17,7 @@
 
 #ifndef IBUSCONNECTOR_HPP
 #define IBUSCONNECTOR_HPP
+#include <chrono>
 #include <stdint.h>
 #include <tcb/span.hpp>
 
@@ -36,6 +37,24 @@ public:
     /// @return true if the FIFO is empty
     virtual bool clearToSend() = 0;
 
+    /// @brief Waits till the FIFO of the target is empty and is able to receive the next chunk of data.
+    ///     Connectors which can block on the target (for instance on an interrupt) should override this.
+    ///     The default implementation polls clearToSend() till the FIFO is empty and ignores the timeout.
+    /// @param timeout The maximum time to wait
+    /// @return true if the FIFO is empty, false when the timeout elapsed (never with the default implementation)
+    virtual bool waitClearToSend(const std::chrono::milliseconds)
+    {
+        while (!clearToSend())
+            ;
+        return true;
+    }
+
+    /// @brief Returns a file descriptor which can be used with poll() or select() to wait till the target is
+    ///     clear to send. It signals POLLOUT when it is. clearToSend() must be called afterwards to finish the
+    ///     previous transfer.
+    /// @return The file descriptor, or -1 if the connector does not provide one
+    virtual int getClearToSendFd() const { return -1; }
+
     /// @brief Requests a buffer which supports the requirements for the given device (for instance DMA capabilities).
     /// @param index The index of the requested buffer
     /// @return Returns the requested buffer, or an empty optional if no buffer is available for the given index
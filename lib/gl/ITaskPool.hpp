@@ -0,0 +1,39 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ITASKPOOL_HPP
+#define ITASKPOOL_HPP
+
+#include <cstddef>
+#include <functional>
+
+namespace rr
+{
+
+// Pool which executes fine-grained tasks in parallel. Other than an IThreadRunner, which runs one operation
+// in one thread, the pool distributes the work of an operation over all of its threads.
+class ITaskPool
+{
+public:
+    // Splits [0, count) into chunks of at least grain elements and calls task(begin, end) for every chunk.
+    // The chunks are executed in parallel. Returns when all chunks are executed.
+    virtual void parallelFor(const std::size_t count, const std::size_t grain, const std::function<void(std::size_t begin, std::size_t end)>& task) = 0;
+};
+
+} // namespace rr
+
+#endif // ITASKPOOL_HPP
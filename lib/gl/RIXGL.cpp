@@ -20,7 +20,7 @@
 #include "glImpl.h"
 #include "pixelpipeline/PixelPipeline.hpp"
 #include "renderer/dse/DmaStreamEngine.hpp"
-#include "renderer/threadedRasterizer/ThreadedRasterizer.hpp"
+#include "vertexpipeline/BufferObjects.hpp"
 #include "vertexpipeline/VertexArray.hpp"
 #include "vertexpipeline/VertexPipeline.hpp"
 #include "vertexpipeline/VertexQueue.hpp"
@@ -29,6 +29,13 @@
 #include <spdlog/spdlog.h>
 #include <stdlib.h>
 #include <string.h>
+#if RIX_CORE_THREADED_RASTERIZATION
+#include "renderer/threadedRasterizer/ThreadedRasterizer.hpp"
+#endif
+#if RIX_CORE_HOSTED_THREADING
+#include "frontend/RecordingContext.hpp"
+#include "frontend/ThreadedFrontEnd.hpp"
+#endif
 
 #define ADDRESS_OF(X) reinterpret_cast<const void*>(&X)
 namespace rr
@@ -40,6 +47,7 @@ RIXGL& RIXGL::getInstance()
     return *instance;
 }
 
+#if RIX_CORE_THREADED_RASTERIZATION
 class WithThreadedRasterization
 {
 public:
@@ -49,13 +57,21 @@ public:
     {
     }
 
+    bool setRasterizerWorkers(tcb::span<IThreadRunner* const> workers) { return device.setWorkers(workers); }
+    bool setRasterizerThread(IThreadRunner* runner)
+    {
+        device.setThread(runner);
+        return true;
+    }
+    DisplayListQueueStatistics getRasterizerQueueStatistics() const { return device.getQueueStatistics(); }
+
     DSEC::DmaStreamEngine dmaStreamEngine;
     ThreadedRasterizer<
         RenderConfig::THREADED_RASTERIZATION_BUFFER_COUNT,
         RenderConfig::THREADED_RASTERIZATION_BUFFER_SIZE>
         device;
 };
-
+#else
 class OnlyDse
 {
 public:
@@ -64,8 +80,13 @@ public:
     {
     }
 
+    bool setRasterizerWorkers(tcb::span<IThreadRunner* const>) { return false; }
+    bool setRasterizerThread(IThreadRunner*) { return false; }
+    DisplayListQueueStatistics getRasterizerQueueStatistics() const { return {}; }
+
     DSEC::DmaStreamEngine device;
 };
+#endif
 
 class RenderDevice
 {
@@ -77,13 +98,18 @@ public:
     {
     }
 
-    using Device = std::conditional<RenderConfig::THREADED_RASTERIZATION, WithThreadedRasterization, OnlyDse>::type;
+#if RIX_CORE_THREADED_RASTERIZATION
+    using Device = WithThreadedRasterization;
+#else
+    using Device = OnlyDse;
+#endif
 
     Device device;
     PixelPipeline pixelPipeline;
     VertexPipeline vertexPipeline;
     VertexQueue vertexQueue {};
     VertexArray vertexArray {};
+    BufferObjects bufferObjects {};
 };
 
 bool RIXGL::createInstance(IBusConnector& busConnector, IThreadRunner& runner)
@@ -107,400 +133,403 @@ void RIXGL::destroy()
 
 RIXGL::RIXGL(IBusConnector& busConnector, IThreadRunner& runner)
     : m_renderDevice { new RenderDevice { busConnector, runner } }
+#if RIX_CORE_HOSTED_THREADING
+    , m_frontEnd { new ThreadedFrontEnd {} }
+#endif
 {
     // Register Open GL 1.0 procedures
-    addLibProcedure("glAccum", ADDRESS_OF(impl_glAccum));
-    addLibProcedure("glAlphaFunc", ADDRESS_OF(impl_glAlphaFunc));
-    addLibProcedure("glBegin", ADDRESS_OF(impl_glBegin));
-    addLibProcedure("glBitmap", ADDRESS_OF(impl_glBitmap));
-    addLibProcedure("glBlendFunc", ADDRESS_OF(impl_glBlendFunc));
-    addLibProcedure("glCallList", ADDRESS_OF(impl_glCallList));
-    addLibProcedure("glCallLists", ADDRESS_OF(impl_glCallLists));
-    addLibProcedure("glClear", ADDRESS_OF(impl_glClear));
-    addLibProcedure("glClearAccum", ADDRESS_OF(impl_glClearAccum));
-    addLibProcedure("glClearColor", ADDRESS_OF(impl_glClearColor));
-    addLibProcedure("glClearDepth", ADDRESS_OF(impl_glClearDepth));
-    addLibProcedure("glClearIndex", ADDRESS_OF(impl_glClearIndex));
-    addLibProcedure("glClearStencil", ADDRESS_OF(impl_glClearStencil));
-    addLibProcedure("glClipPlane", ADDRESS_OF(impl_glClipPlane));
-    addLibProcedure("glColor3b", ADDRESS_OF(impl_glColor3b));
-    addLibProcedure("glColor3bv", ADDRESS_OF(impl_glColor3bv));
-    addLibProcedure("glColor3d", ADDRESS_OF(impl_glColor3d));
-    addLibProcedure("glColor3dv", ADDRESS_OF(impl_glColor3dv));
-    addLibProcedure("glColor3f", ADDRESS_OF(impl_glColor3f));
-    addLibProcedure("glColor3fv", ADDRESS_OF(impl_glColor3fv));
-    addLibProcedure("glColor3i", ADDRESS_OF(impl_glColor3i));
-    addLibProcedure("glColor3iv", ADDRESS_OF(impl_glColor3iv));
-    addLibProcedure("glColor3s", ADDRESS_OF(impl_glColor3s));
-    addLibProcedure("glColor3sv", ADDRESS_OF(impl_glColor3sv));
-    addLibProcedure("glColor3ub", ADDRESS_OF(impl_glColor3ub));
-    addLibProcedure("glColor3ubv", ADDRESS_OF(impl_glColor3ubv));
-    addLibProcedure("glColor3ui", ADDRESS_OF(impl_glColor3ui));
-    addLibProcedure("glColor3uiv", ADDRESS_OF(impl_glColor3uiv));
-    addLibProcedure("glColor3us", ADDRESS_OF(impl_glColor3us));
-    addLibProcedure("glColor3usv", ADDRESS_OF(impl_glColor3usv));
-    addLibProcedure("glColor4b", ADDRESS_OF(impl_glColor4b));
-    addLibProcedure("glColor4bv", ADDRESS_OF(impl_glColor4bv));
-    addLibProcedure("glColor4d", ADDRESS_OF(impl_glColor4d));
-    addLibProcedure("glColor4dv", ADDRESS_OF(impl_glColor4dv));
-    addLibProcedure("glColor4f", ADDRESS_OF(impl_glColor4f));
-    addLibProcedure("glColor4fv", ADDRESS_OF(impl_glColor4fv));
-    addLibProcedure("glColor4i", ADDRESS_OF(impl_glColor4i));
-    addLibProcedure("glColor4iv", ADDRESS_OF(impl_glColor4iv));
-    addLibProcedure("glColor4s", ADDRESS_OF(impl_glColor4s));
-    addLibProcedure("glColor4sv", ADDRESS_OF(impl_glColor4sv));
-    addLibProcedure("glColor4ub", ADDRESS_OF(impl_glColor4ub));
-    addLibProcedure("glColor4ubv", ADDRESS_OF(impl_glColor4ubv));
-    addLibProcedure("glColor4ui", ADDRESS_OF(impl_glColor4ui));
-    addLibProcedure("glColor4uiv", ADDRESS_OF(impl_glColor4uiv));
-    addLibProcedure("glColor4us", ADDRESS_OF(impl_glColor4us));
-    addLibProcedure("glColor4usv", ADDRESS_OF(impl_glColor4usv));
-    addLibProcedure("glColorMask", ADDRESS_OF(impl_glColorMask));
-    addLibProcedure("glColorMaterial", ADDRESS_OF(impl_glColorMaterial));
-    addLibProcedure("glCopyPixels", ADDRESS_OF(impl_glCopyPixels));
-    addLibProcedure("glCullFace", ADDRESS_OF(impl_glCullFace));
-    addLibProcedure("glDeleteLists", ADDRESS_OF(impl_glDeleteLists));
-    addLibProcedure("glDepthFunc", ADDRESS_OF(impl_glDepthFunc));
-    addLibProcedure("glDepthMask", ADDRESS_OF(impl_glDepthMask));
-    addLibProcedure("glDepthRange", ADDRESS_OF(impl_glDepthRange));
-    addLibProcedure("glDisable", ADDRESS_OF(impl_glDisable));
-    addLibProcedure("glDrawBuffer", ADDRESS_OF(impl_glDrawBuffer));
-    addLibProcedure("glDrawPixels", ADDRESS_OF(impl_glDrawPixels));
-    addLibProcedure("glEdgeFlag", ADDRESS_OF(impl_glEdgeFlag));
-    addLibProcedure("glEdgeFlagv", ADDRESS_OF(impl_glEdgeFlagv));
-    addLibProcedure("glEnable", ADDRESS_OF(impl_glEnable));
-    addLibProcedure("glEnd", ADDRESS_OF(impl_glEnd));
-    addLibProcedure("glEndList", ADDRESS_OF(impl_glEndList));
-    addLibProcedure("glEvalCoord1d", ADDRESS_OF(impl_glEvalCoord1d));
-    addLibProcedure("glEvalCoord1dv", ADDRESS_OF(impl_glEvalCoord1dv));
-    addLibProcedure("glEvalCoord1f", ADDRESS_OF(impl_glEvalCoord1f));
-    addLibProcedure("glEvalCoord1fv", ADDRESS_OF(impl_glEvalCoord1fv));
-    addLibProcedure("glEvalCoord2d", ADDRESS_OF(impl_glEvalCoord2d));
-    addLibProcedure("glEvalCoord2dv", ADDRESS_OF(impl_glEvalCoord2dv));
-    addLibProcedure("glEvalCoord2f", ADDRESS_OF(impl_glEvalCoord2f));
-    addLibProcedure("glEvalCoord2fv", ADDRESS_OF(impl_glEvalCoord2fv));
-    addLibProcedure("glEvalMesh1", ADDRESS_OF(impl_glEvalMesh1));
-    addLibProcedure("glEvalMesh2", ADDRESS_OF(impl_glEvalMesh2));
-    addLibProcedure("glEvalPoint1", ADDRESS_OF(impl_glEvalPoint1));
-    addLibProcedure("glEvalPoint2", ADDRESS_OF(impl_glEvalPoint2));
-    addLibProcedure("glFeedbackBuffer", ADDRESS_OF(impl_glFeedbackBuffer));
-    addLibProcedure("glFinish", ADDRESS_OF(impl_glFinish));
-    addLibProcedure("glFlush", ADDRESS_OF(impl_glFlush));
-    addLibProcedure("glFogf", ADDRESS_OF(impl_glFogf));
-    addLibProcedure("glFogfv", ADDRESS_OF(impl_glFogfv));
-    addLibProcedure("glFogi", ADDRESS_OF(impl_glFogi));
-    addLibProcedure("glFogiv", ADDRESS_OF(impl_glFogiv));
-    addLibProcedure("glFrontFace", ADDRESS_OF(impl_glFrontFace));
-    addLibProcedure("glFrustum", ADDRESS_OF(impl_glFrustum));
-    addLibProcedure("glGenLists", ADDRESS_OF(impl_glGenLists));
-    addLibProcedure("glGetBooleanv", ADDRESS_OF(impl_glGetBooleanv));
-    addLibProcedure("glGetClipPlane", ADDRESS_OF(impl_glGetClipPlane));
-    addLibProcedure("glGetDoublev", ADDRESS_OF(impl_glGetDoublev));
-    addLibProcedure("glGetError", ADDRESS_OF(impl_glGetError));
-    addLibProcedure("glGetFloatv", ADDRESS_OF(impl_glGetFloatv));
-    addLibProcedure("glGetIntegerv", ADDRESS_OF(impl_glGetIntegerv));
-    addLibProcedure("glGetLightfv", ADDRESS_OF(impl_glGetLightfv));
-    addLibProcedure("glGetLightiv", ADDRESS_OF(impl_glGetLightiv));
-    addLibProcedure("glGetMapdv", ADDRESS_OF(impl_glGetMapdv));
-    addLibProcedure("glGetMapfv", ADDRESS_OF(impl_glGetMapfv));
-    addLibProcedure("glGetMapiv", ADDRESS_OF(impl_glGetMapiv));
-    addLibProcedure("glGetMaterialfv", ADDRESS_OF(impl_glGetMaterialfv));
-    addLibProcedure("glGetMaterialiv", ADDRESS_OF(impl_glGetMaterialiv));
-    addLibProcedure("glGetPixelMapfv", ADDRESS_OF(impl_glGetPixelMapfv));
-    addLibProcedure("glGetPixelMapuiv", ADDRESS_OF(impl_glGetPixelMapuiv));
-    addLibProcedure("glGetPixelMapusv", ADDRESS_OF(impl_glGetPixelMapusv));
-    addLibProcedure("glGetPolygonStipple", ADDRESS_OF(impl_glGetPolygonStipple));
-    addLibProcedure("glGetString", ADDRESS_OF(impl_glGetString));
-    addLibProcedure("glGetTexEnvfv", ADDRESS_OF(impl_glGetTexEnvfv));
-    addLibProcedure("glGetTexEnviv", ADDRESS_OF(impl_glGetTexEnviv));
-    addLibProcedure("glGetTexGendv", ADDRESS_OF(impl_glGetTexGendv));
-    addLibProcedure("glGetTexGenfv", ADDRESS_OF(impl_glGetTexGenfv));
-    addLibProcedure("glGetTexGeniv", ADDRESS_OF(impl_glGetTexGeniv));
-    addLibProcedure("glGetTexImage", ADDRESS_OF(impl_glGetTexImage));
-    addLibProcedure("glGetTexLevelParameterfv", ADDRESS_OF(impl_glGetTexLevelParameterfv));
-    addLibProcedure("glGetTexLevelParameteriv", ADDRESS_OF(impl_glGetTexLevelParameteriv));
-    addLibProcedure("glGetTexParameterfv", ADDRESS_OF(impl_glGetTexParameterfv));
-    addLibProcedure("glGetTexParameteriv", ADDRESS_OF(impl_glGetTexParameteriv));
-    addLibProcedure("glHint", ADDRESS_OF(impl_glHint));
-    addLibProcedure("glIndexMask", ADDRESS_OF(impl_glIndexMask));
-    addLibProcedure("glIndexd", ADDRESS_OF(impl_glIndexd));
-    addLibProcedure("glIndexdv", ADDRESS_OF(impl_glIndexdv));
-    addLibProcedure("glIndexf", ADDRESS_OF(impl_glIndexf));
-    addLibProcedure("glIndexfv", ADDRESS_OF(impl_glIndexfv));
-    addLibProcedure("glIndexi", ADDRESS_OF(impl_glIndexi));
-    addLibProcedure("glIndexiv", ADDRESS_OF(impl_glIndexiv));
-    addLibProcedure("glIndexs", ADDRESS_OF(impl_glIndexs));
-    addLibProcedure("glIndexsv", ADDRESS_OF(impl_glIndexsv));
-    addLibProcedure("glInitNames", ADDRESS_OF(impl_glInitNames));
-    addLibProcedure("glIsEnabled", ADDRESS_OF(impl_glIsEnabled));
-    addLibProcedure("glIsList", ADDRESS_OF(impl_glIsList));
-    addLibProcedure("glLightModelf", ADDRESS_OF(impl_glLightModelf));
-    addLibProcedure("glLightModelfv", ADDRESS_OF(impl_glLightModelfv));
-    addLibProcedure("glLightModeli", ADDRESS_OF(impl_glLightModeli));
-    addLibProcedure("glLightModeliv", ADDRESS_OF(impl_glLightModeliv));
-    addLibProcedure("glLightf", ADDRESS_OF(impl_glLightf));
-    addLibProcedure("glLightfv", ADDRESS_OF(impl_glLightfv));
-    addLibProcedure("glLighti", ADDRESS_OF(impl_glLighti));
-    addLibProcedure("glLightiv", ADDRESS_OF(impl_glLightiv));
-    addLibProcedure("glLineStipple", ADDRESS_OF(impl_glLineStipple));
-    addLibProcedure("glLineWidth", ADDRESS_OF(impl_glLineWidth));
-    addLibProcedure("glListBase", ADDRESS_OF(impl_glListBase));
-    addLibProcedure("glLoadIdentity", ADDRESS_OF(impl_glLoadIdentity));
-    addLibProcedure("glLoadMatrixd", ADDRESS_OF(impl_glLoadMatrixd));
-    addLibProcedure("glLoadMatrixf", ADDRESS_OF(impl_glLoadMatrixf));
-    addLibProcedure("glLoadName", ADDRESS_OF(impl_glLoadName));
-    addLibProcedure("glLogicOp", ADDRESS_OF(impl_glLogicOp));
-    addLibProcedure("glMap1d", ADDRESS_OF(impl_glMap1d));
-    addLibProcedure("glMap1f", ADDRESS_OF(impl_glMap1f));
-    addLibProcedure("glMap2d", ADDRESS_OF(impl_glMap2d));
-    addLibProcedure("glMap2f", ADDRESS_OF(impl_glMap2f));
-    addLibProcedure("glMapGrid1d", ADDRESS_OF(impl_glMapGrid1d));
-    addLibProcedure("glMapGrid1f", ADDRESS_OF(impl_glMapGrid1f));
-    addLibProcedure("glMapGrid2d", ADDRESS_OF(impl_glMapGrid2d));
-    addLibProcedure("glMapGrid2f", ADDRESS_OF(impl_glMapGrid2f));
-    addLibProcedure("glMaterialf", ADDRESS_OF(impl_glMaterialf));
-    addLibProcedure("glMaterialfv", ADDRESS_OF(impl_glMaterialfv));
-    addLibProcedure("glMateriali", ADDRESS_OF(impl_glMateriali));
-    addLibProcedure("glMaterialiv", ADDRESS_OF(impl_glMaterialiv));
-    addLibProcedure("glMatrixMode", ADDRESS_OF(impl_glMatrixMode));
-    addLibProcedure("glMultMatrixd", ADDRESS_OF(impl_glMultMatrixd));
-    addLibProcedure("glMultMatrixf", ADDRESS_OF(impl_glMultMatrixf));
-    addLibProcedure("glNewList", ADDRESS_OF(impl_glNewList));
-    addLibProcedure("glNormal3b", ADDRESS_OF(impl_glNormal3b));
-    addLibProcedure("glNormal3bv", ADDRESS_OF(impl_glNormal3bv));
-    addLibProcedure("glNormal3d", ADDRESS_OF(impl_glNormal3d));
-    addLibProcedure("glNormal3dv", ADDRESS_OF(impl_glNormal3dv));
-    addLibProcedure("glNormal3f", ADDRESS_OF(impl_glNormal3f));
-    addLibProcedure("glNormal3fv", ADDRESS_OF(impl_glNormal3fv));
-    addLibProcedure("glNormal3i", ADDRESS_OF(impl_glNormal3i));
-    addLibProcedure("glNormal3iv", ADDRESS_OF(impl_glNormal3iv));
-    addLibProcedure("glNormal3s", ADDRESS_OF(impl_glNormal3s));
-    addLibProcedure("glNormal3sv", ADDRESS_OF(impl_glNormal3sv));
-    addLibProcedure("glOrtho", ADDRESS_OF(impl_glOrtho));
-    addLibProcedure("glPassThrough", ADDRESS_OF(impl_glPassThrough));
-    addLibProcedure("glPixelMapfv", ADDRESS_OF(impl_glPixelMapfv));
-    addLibProcedure("glPixelMapuiv", ADDRESS_OF(impl_glPixelMapuiv));
-    addLibProcedure("glPixelMapusv", ADDRESS_OF(impl_glPixelMapusv));
-    addLibProcedure("glPixelStoref", ADDRESS_OF(impl_glPixelStoref));
-    addLibProcedure("glPixelStorei", ADDRESS_OF(impl_glPixelStorei));
-    addLibProcedure("glPixelTransferf", ADDRESS_OF(impl_glPixelTransferf));
-    addLibProcedure("glPixelTransferi", ADDRESS_OF(impl_glPixelTransferi));
-    addLibProcedure("glPixelZoom", ADDRESS_OF(impl_glPixelZoom));
-    addLibProcedure("glPointSize", ADDRESS_OF(impl_glPointSize));
-    addLibProcedure("glPolygonMode", ADDRESS_OF(impl_glPolygonMode));
-    addLibProcedure("glPolygonStipple", ADDRESS_OF(impl_glPolygonStipple));
-    addLibProcedure("glPopAttrib", ADDRESS_OF(impl_glPopAttrib));
-    addLibProcedure("glPopMatrix", ADDRESS_OF(impl_glPopMatrix));
-    addLibProcedure("glPopName", ADDRESS_OF(impl_glPopName));
-    addLibProcedure("glPushAttrib", ADDRESS_OF(impl_glPushAttrib));
-    addLibProcedure("glPushMatrix", ADDRESS_OF(impl_glPushMatrix));
-    addLibProcedure("glPushName", ADDRESS_OF(impl_glPushName));
-    addLibProcedure("glRasterPos2d", ADDRESS_OF(impl_glRasterPos2d));
-    addLibProcedure("glRasterPos2dv", ADDRESS_OF(impl_glRasterPos2dv));
-    addLibProcedure("glRasterPos2f", ADDRESS_OF(impl_glRasterPos2f));
-    addLibProcedure("glRasterPos2fv", ADDRESS_OF(impl_glRasterPos2fv));
-    addLibProcedure("glRasterPos2i", ADDRESS_OF(impl_glRasterPos2i));
-    addLibProcedure("glRasterPos2iv", ADDRESS_OF(impl_glRasterPos2iv));
-    addLibProcedure("glRasterPos2s", ADDRESS_OF(impl_glRasterPos2s));
-    addLibProcedure("glRasterPos2sv", ADDRESS_OF(impl_glRasterPos2sv));
-    addLibProcedure("glRasterPos3d", ADDRESS_OF(impl_glRasterPos3d));
-    addLibProcedure("glRasterPos3dv", ADDRESS_OF(impl_glRasterPos3dv));
-    addLibProcedure("glRasterPos3f", ADDRESS_OF(impl_glRasterPos3f));
-    addLibProcedure("glRasterPos3fv", ADDRESS_OF(impl_glRasterPos3fv));
-    addLibProcedure("glRasterPos3i", ADDRESS_OF(impl_glRasterPos3i));
-    addLibProcedure("glRasterPos3iv", ADDRESS_OF(impl_glRasterPos3iv));
-    addLibProcedure("glRasterPos3s", ADDRESS_OF(impl_glRasterPos3s));
-    addLibProcedure("glRasterPos3sv", ADDRESS_OF(impl_glRasterPos3sv));
-    addLibProcedure("glRasterPos4d", ADDRESS_OF(impl_glRasterPos4d));
-    addLibProcedure("glRasterPos4dv", ADDRESS_OF(impl_glRasterPos4dv));
-    addLibProcedure("glRasterPos4f", ADDRESS_OF(impl_glRasterPos4f));
-    addLibProcedure("glRasterPos4fv", ADDRESS_OF(impl_glRasterPos4fv));
-    addLibProcedure("glRasterPos4i", ADDRESS_OF(impl_glRasterPos4i));
-    addLibProcedure("glRasterPos4iv", ADDRESS_OF(impl_glRasterPos4iv));
-    addLibProcedure("glRasterPos4s", ADDRESS_OF(impl_glRasterPos4s));
-    addLibProcedure("glRasterPos4sv", ADDRESS_OF(impl_glRasterPos4sv));
-    addLibProcedure("glReadBuffer", ADDRESS_OF(impl_glReadBuffer));
-    addLibProcedure("glReadPixels", ADDRESS_OF(impl_glReadPixels));
-    addLibProcedure("glRectd", ADDRESS_OF(impl_glRectd));
-    addLibProcedure("glRectdv", ADDRESS_OF(impl_glRectdv));
-    addLibProcedure("glRectf", ADDRESS_OF(impl_glRectf));
-    addLibProcedure("glRectfv", ADDRESS_OF(impl_glRectfv));
-    addLibProcedure("glRecti", ADDRESS_OF(impl_glRecti));
-    addLibProcedure("glRectiv", ADDRESS_OF(impl_glRectiv));
-    addLibProcedure("glRects", ADDRESS_OF(impl_glRects));
-    addLibProcedure("glRectsv", ADDRESS_OF(impl_glRectsv));
-    addLibProcedure("glRenderMode", ADDRESS_OF(impl_glRenderMode));
-    addLibProcedure("glRotated", ADDRESS_OF(impl_glRotated));
-    addLibProcedure("glRotatef", ADDRESS_OF(impl_glRotatef));
-    addLibProcedure("glScaled", ADDRESS_OF(impl_glScaled));
-    addLibProcedure("glScalef", ADDRESS_OF(impl_glScalef));
-    addLibProcedure("glScissor", ADDRESS_OF(impl_glScissor));
-    addLibProcedure("glSelectBuffer", ADDRESS_OF(impl_glSelectBuffer));
-    addLibProcedure("glShadeModel", ADDRESS_OF(impl_glShadeModel));
-    addLibProcedure("glStencilFunc", ADDRESS_OF(impl_glStencilFunc));
-    addLibProcedure("glStencilMask", ADDRESS_OF(impl_glStencilMask));
-    addLibProcedure("glStencilOp", ADDRESS_OF(impl_glStencilOp));
-    addLibProcedure("glTexCoord1d", ADDRESS_OF(impl_glTexCoord1d));
-    addLibProcedure("glTexCoord1dv", ADDRESS_OF(impl_glTexCoord1dv));
-    addLibProcedure("glTexCoord1f", ADDRESS_OF(impl_glTexCoord1f));
-    addLibProcedure("glTexCoord1fv", ADDRESS_OF(impl_glTexCoord1fv));
-    addLibProcedure("glTexCoord1i", ADDRESS_OF(impl_glTexCoord1i));
-    addLibProcedure("glTexCoord1iv", ADDRESS_OF(impl_glTexCoord1iv));
-    addLibProcedure("glTexCoord1s", ADDRESS_OF(impl_glTexCoord1s));
-    addLibProcedure("glTexCoord1sv", ADDRESS_OF(impl_glTexCoord1sv));
-    addLibProcedure("glTexCoord2d", ADDRESS_OF(impl_glTexCoord2d));
-    addLibProcedure("glTexCoord2dv", ADDRESS_OF(impl_glTexCoord2dv));
-    addLibProcedure("glTexCoord2f", ADDRESS_OF(impl_glTexCoord2f));
-    addLibProcedure("glTexCoord2fv", ADDRESS_OF(impl_glTexCoord2fv));
-    addLibProcedure("glTexCoord2i", ADDRESS_OF(impl_glTexCoord2i));
-    addLibProcedure("glTexCoord2iv", ADDRESS_OF(impl_glTexCoord2iv));
-    addLibProcedure("glTexCoord2s", ADDRESS_OF(impl_glTexCoord2s));
-    addLibProcedure("glTexCoord2sv", ADDRESS_OF(impl_glTexCoord2sv));
-    addLibProcedure("glTexCoord3d", ADDRESS_OF(impl_glTexCoord3d));
-    addLibProcedure("glTexCoord3dv", ADDRESS_OF(impl_glTexCoord3dv));
-    addLibProcedure("glTexCoord3f", ADDRESS_OF(impl_glTexCoord3f));
-    addLibProcedure("glTexCoord3fv", ADDRESS_OF(impl_glTexCoord3fv));
-    addLibProcedure("glTexCoord3i", ADDRESS_OF(impl_glTexCoord3i));
-    addLibProcedure("glTexCoord3iv", ADDRESS_OF(impl_glTexCoord3iv));
-    addLibProcedure("glTexCoord3s", ADDRESS_OF(impl_glTexCoord3s));
-    addLibProcedure("glTexCoord3sv", ADDRESS_OF(impl_glTexCoord3sv));
-    addLibProcedure("glTexCoord4d", ADDRESS_OF(impl_glTexCoord4d));
-    addLibProcedure("glTexCoord4dv", ADDRESS_OF(impl_glTexCoord4dv));
-    addLibProcedure("glTexCoord4f", ADDRESS_OF(impl_glTexCoord4f));
-    addLibProcedure("glTexCoord4fv", ADDRESS_OF(impl_glTexCoord4fv));
-    addLibProcedure("glTexCoord4i", ADDRESS_OF(impl_glTexCoord4i));
-    addLibProcedure("glTexCoord4iv", ADDRESS_OF(impl_glTexCoord4iv));
-    addLibProcedure("glTexCoord4s", ADDRESS_OF(impl_glTexCoord4s));
-    addLibProcedure("glTexCoord4sv", ADDRESS_OF(impl_glTexCoord4sv));
-    addLibProcedure("glTexEnvf", ADDRESS_OF(impl_glTexEnvf));
-    addLibProcedure("glTexEnvfv", ADDRESS_OF(impl_glTexEnvfv));
-    addLibProcedure("glTexEnvi", ADDRESS_OF(impl_glTexEnvi));
-    addLibProcedure("glTexEnviv", ADDRESS_OF(impl_glTexEnviv));
-    addLibProcedure("glTexGend", ADDRESS_OF(impl_glTexGend));
-    addLibProcedure("glTexGendv", ADDRESS_OF(impl_glTexGendv));
-    addLibProcedure("glTexGenf", ADDRESS_OF(impl_glTexGenf));
-    addLibProcedure("glTexGenfv", ADDRESS_OF(impl_glTexGenfv));
-    addLibProcedure("glTexGeni", ADDRESS_OF(impl_glTexGeni));
-    addLibProcedure("glTexGeniv", ADDRESS_OF(impl_glTexGeniv));
-    addLibProcedure("glTexImage1D", ADDRESS_OF(impl_glTexImage1D));
-    addLibProcedure("glTexImage2D", ADDRESS_OF(impl_glTexImage2D));
-    addLibProcedure("glTexParameterf", ADDRESS_OF(impl_glTexParameterf));
-    addLibProcedure("glTexParameterfv", ADDRESS_OF(impl_glTexParameterfv));
-    addLibProcedure("glTexParameteri", ADDRESS_OF(impl_glTexParameteri));
-    addLibProcedure("glTexParameteriv", ADDRESS_OF(impl_glTexParameteriv));
-    addLibProcedure("glTranslated", ADDRESS_OF(impl_glTranslated));
-    addLibProcedure("glTranslatef", ADDRESS_OF(impl_glTranslatef));
-    addLibProcedure("glVertex2d", ADDRESS_OF(impl_glVertex2d));
-    addLibProcedure("glVertex2dv", ADDRESS_OF(impl_glVertex2dv));
-    addLibProcedure("glVertex2f", ADDRESS_OF(impl_glVertex2f));
-    addLibProcedure("glVertex2fv", ADDRESS_OF(impl_glVertex2fv));
-    addLibProcedure("glVertex2i", ADDRESS_OF(impl_glVertex2i));
-    addLibProcedure("glVertex2iv", ADDRESS_OF(impl_glVertex2iv));
-    addLibProcedure("glVertex2s", ADDRESS_OF(impl_glVertex2s));
-    addLibProcedure("glVertex2sv", ADDRESS_OF(impl_glVertex2sv));
-    addLibProcedure("glVertex3d", ADDRESS_OF(impl_glVertex3d));
-    addLibProcedure("glVertex3dv", ADDRESS_OF(impl_glVertex3dv));
-    addLibProcedure("glVertex3f", ADDRESS_OF(impl_glVertex3f));
-    addLibProcedure("glVertex3fv", ADDRESS_OF(impl_glVertex3fv));
-    addLibProcedure("glVertex3i", ADDRESS_OF(impl_glVertex3i));
-    addLibProcedure("glVertex3iv", ADDRESS_OF(impl_glVertex3iv));
-    addLibProcedure("glVertex3s", ADDRESS_OF(impl_glVertex3s));
-    addLibProcedure("glVertex3sv", ADDRESS_OF(impl_glVertex3sv));
-    addLibProcedure("glVertex4d", ADDRESS_OF(impl_glVertex4d));
-    addLibProcedure("glVertex4dv", ADDRESS_OF(impl_glVertex4dv));
-    addLibProcedure("glVertex4f", ADDRESS_OF(impl_glVertex4f));
-    addLibProcedure("glVertex4fv", ADDRESS_OF(impl_glVertex4fv));
-    addLibProcedure("glVertex4i", ADDRESS_OF(impl_glVertex4i));
-    addLibProcedure("glVertex4iv", ADDRESS_OF(impl_glVertex4iv));
-    addLibProcedure("glVertex4s", ADDRESS_OF(impl_glVertex4s));
-    addLibProcedure("glVertex4sv", ADDRESS_OF(impl_glVertex4sv));
-    addLibProcedure("glViewport", ADDRESS_OF(impl_glViewport));
+    addLibProcedure("glAccum", ADDRESS_OF(glAccum));
+    addLibProcedure("glAlphaFunc", ADDRESS_OF(glAlphaFunc));
+    addLibProcedure("glBegin", ADDRESS_OF(glBegin));
+    addLibProcedure("glBitmap", ADDRESS_OF(glBitmap));
+    addLibProcedure("glBlendFunc", ADDRESS_OF(glBlendFunc));
+    addLibProcedure("glCallList", ADDRESS_OF(glCallList));
+    addLibProcedure("glCallLists", ADDRESS_OF(glCallLists));
+    addLibProcedure("glClear", ADDRESS_OF(glClear));
+    addLibProcedure("glClearAccum", ADDRESS_OF(glClearAccum));
+    addLibProcedure("glClearColor", ADDRESS_OF(glClearColor));
+    addLibProcedure("glClearDepth", ADDRESS_OF(glClearDepth));
+    addLibProcedure("glClearIndex", ADDRESS_OF(glClearIndex));
+    addLibProcedure("glClearStencil", ADDRESS_OF(glClearStencil));
+    addLibProcedure("glClipPlane", ADDRESS_OF(glClipPlane));
+    addLibProcedure("glColor3b", ADDRESS_OF(glColor3b));
+    addLibProcedure("glColor3bv", ADDRESS_OF(glColor3bv));
+    addLibProcedure("glColor3d", ADDRESS_OF(glColor3d));
+    addLibProcedure("glColor3dv", ADDRESS_OF(glColor3dv));
+    addLibProcedure("glColor3f", ADDRESS_OF(glColor3f));
+    addLibProcedure("glColor3fv", ADDRESS_OF(glColor3fv));
+    addLibProcedure("glColor3i", ADDRESS_OF(glColor3i));
+    addLibProcedure("glColor3iv", ADDRESS_OF(glColor3iv));
+    addLibProcedure("glColor3s", ADDRESS_OF(glColor3s));
+    addLibProcedure("glColor3sv", ADDRESS_OF(glColor3sv));
+    addLibProcedure("glColor3ub", ADDRESS_OF(glColor3ub));
+    addLibProcedure("glColor3ubv", ADDRESS_OF(glColor3ubv));
+    addLibProcedure("glColor3ui", ADDRESS_OF(glColor3ui));
+    addLibProcedure("glColor3uiv", ADDRESS_OF(glColor3uiv));
+    addLibProcedure("glColor3us", ADDRESS_OF(glColor3us));
+    addLibProcedure("glColor3usv", ADDRESS_OF(glColor3usv));
+    addLibProcedure("glColor4b", ADDRESS_OF(glColor4b));
+    addLibProcedure("glColor4bv", ADDRESS_OF(glColor4bv));
+    addLibProcedure("glColor4d", ADDRESS_OF(glColor4d));
+    addLibProcedure("glColor4dv", ADDRESS_OF(glColor4dv));
+    addLibProcedure("glColor4f", ADDRESS_OF(glColor4f));
+    addLibProcedure("glColor4fv", ADDRESS_OF(glColor4fv));
+    addLibProcedure("glColor4i", ADDRESS_OF(glColor4i));
+    addLibProcedure("glColor4iv", ADDRESS_OF(glColor4iv));
+    addLibProcedure("glColor4s", ADDRESS_OF(glColor4s));
+    addLibProcedure("glColor4sv", ADDRESS_OF(glColor4sv));
+    addLibProcedure("glColor4ub", ADDRESS_OF(glColor4ub));
+    addLibProcedure("glColor4ubv", ADDRESS_OF(glColor4ubv));
+    addLibProcedure("glColor4ui", ADDRESS_OF(glColor4ui));
+    addLibProcedure("glColor4uiv", ADDRESS_OF(glColor4uiv));
+    addLibProcedure("glColor4us", ADDRESS_OF(glColor4us));
+    addLibProcedure("glColor4usv", ADDRESS_OF(glColor4usv));
+    addLibProcedure("glColorMask", ADDRESS_OF(glColorMask));
+    addLibProcedure("glColorMaterial", ADDRESS_OF(glColorMaterial));
+    addLibProcedure("glCopyPixels", ADDRESS_OF(glCopyPixels));
+    addLibProcedure("glCullFace", ADDRESS_OF(glCullFace));
+    addLibProcedure("glDeleteLists", ADDRESS_OF(glDeleteLists));
+    addLibProcedure("glDepthFunc", ADDRESS_OF(glDepthFunc));
+    addLibProcedure("glDepthMask", ADDRESS_OF(glDepthMask));
+    addLibProcedure("glDepthRange", ADDRESS_OF(glDepthRange));
+    addLibProcedure("glDisable", ADDRESS_OF(glDisable));
+    addLibProcedure("glDrawBuffer", ADDRESS_OF(glDrawBuffer));
+    addLibProcedure("glDrawPixels", ADDRESS_OF(glDrawPixels));
+    addLibProcedure("glEdgeFlag", ADDRESS_OF(glEdgeFlag));
+    addLibProcedure("glEdgeFlagv", ADDRESS_OF(glEdgeFlagv));
+    addLibProcedure("glEnable", ADDRESS_OF(glEnable));
+    addLibProcedure("glEnd", ADDRESS_OF(glEnd));
+    addLibProcedure("glEndList", ADDRESS_OF(glEndList));
+    addLibProcedure("glEvalCoord1d", ADDRESS_OF(glEvalCoord1d));
+    addLibProcedure("glEvalCoord1dv", ADDRESS_OF(glEvalCoord1dv));
+    addLibProcedure("glEvalCoord1f", ADDRESS_OF(glEvalCoord1f));
+    addLibProcedure("glEvalCoord1fv", ADDRESS_OF(glEvalCoord1fv));
+    addLibProcedure("glEvalCoord2d", ADDRESS_OF(glEvalCoord2d));
+    addLibProcedure("glEvalCoord2dv", ADDRESS_OF(glEvalCoord2dv));
+    addLibProcedure("glEvalCoord2f", ADDRESS_OF(glEvalCoord2f));
+    addLibProcedure("glEvalCoord2fv", ADDRESS_OF(glEvalCoord2fv));
+    addLibProcedure("glEvalMesh1", ADDRESS_OF(glEvalMesh1));
+    addLibProcedure("glEvalMesh2", ADDRESS_OF(glEvalMesh2));
+    addLibProcedure("glEvalPoint1", ADDRESS_OF(glEvalPoint1));
+    addLibProcedure("glEvalPoint2", ADDRESS_OF(glEvalPoint2));
+    addLibProcedure("glFeedbackBuffer", ADDRESS_OF(glFeedbackBuffer));
+    addLibProcedure("glFinish", ADDRESS_OF(glFinish));
+    addLibProcedure("glFlush", ADDRESS_OF(glFlush));
+    addLibProcedure("glFogf", ADDRESS_OF(glFogf));
+    addLibProcedure("glFogfv", ADDRESS_OF(glFogfv));
+    addLibProcedure("glFogi", ADDRESS_OF(glFogi));
+    addLibProcedure("glFogiv", ADDRESS_OF(glFogiv));
+    addLibProcedure("glFrontFace", ADDRESS_OF(glFrontFace));
+    addLibProcedure("glFrustum", ADDRESS_OF(glFrustum));
+    addLibProcedure("glGenLists", ADDRESS_OF(glGenLists));
+    addLibProcedure("glGetBooleanv", ADDRESS_OF(glGetBooleanv));
+    addLibProcedure("glGetClipPlane", ADDRESS_OF(glGetClipPlane));
+    addLibProcedure("glGetDoublev", ADDRESS_OF(glGetDoublev));
+    addLibProcedure("glGetError", ADDRESS_OF(glGetError));
+    addLibProcedure("glGetFloatv", ADDRESS_OF(glGetFloatv));
+    addLibProcedure("glGetIntegerv", ADDRESS_OF(glGetIntegerv));
+    addLibProcedure("glGetLightfv", ADDRESS_OF(glGetLightfv));
+    addLibProcedure("glGetLightiv", ADDRESS_OF(glGetLightiv));
+    addLibProcedure("glGetMapdv", ADDRESS_OF(glGetMapdv));
+    addLibProcedure("glGetMapfv", ADDRESS_OF(glGetMapfv));
+    addLibProcedure("glGetMapiv", ADDRESS_OF(glGetMapiv));
+    addLibProcedure("glGetMaterialfv", ADDRESS_OF(glGetMaterialfv));
+    addLibProcedure("glGetMaterialiv", ADDRESS_OF(glGetMaterialiv));
+    addLibProcedure("glGetPixelMapfv", ADDRESS_OF(glGetPixelMapfv));
+    addLibProcedure("glGetPixelMapuiv", ADDRESS_OF(glGetPixelMapuiv));
+    addLibProcedure("glGetPixelMapusv", ADDRESS_OF(glGetPixelMapusv));
+    addLibProcedure("glGetPolygonStipple", ADDRESS_OF(glGetPolygonStipple));
+    addLibProcedure("glGetString", ADDRESS_OF(glGetString));
+    addLibProcedure("glGetTexEnvfv", ADDRESS_OF(glGetTexEnvfv));
+    addLibProcedure("glGetTexEnviv", ADDRESS_OF(glGetTexEnviv));
+    addLibProcedure("glGetTexGendv", ADDRESS_OF(glGetTexGendv));
+    addLibProcedure("glGetTexGenfv", ADDRESS_OF(glGetTexGenfv));
+    addLibProcedure("glGetTexGeniv", ADDRESS_OF(glGetTexGeniv));
+    addLibProcedure("glGetTexImage", ADDRESS_OF(glGetTexImage));
+    addLibProcedure("glGetTexLevelParameterfv", ADDRESS_OF(glGetTexLevelParameterfv));
+    addLibProcedure("glGetTexLevelParameteriv", ADDRESS_OF(glGetTexLevelParameteriv));
+    addLibProcedure("glGetTexParameterfv", ADDRESS_OF(glGetTexParameterfv));
+    addLibProcedure("glGetTexParameteriv", ADDRESS_OF(glGetTexParameteriv));
+    addLibProcedure("glHint", ADDRESS_OF(glHint));
+    addLibProcedure("glIndexMask", ADDRESS_OF(glIndexMask));
+    addLibProcedure("glIndexd", ADDRESS_OF(glIndexd));
+    addLibProcedure("glIndexdv", ADDRESS_OF(glIndexdv));
+    addLibProcedure("glIndexf", ADDRESS_OF(glIndexf));
+    addLibProcedure("glIndexfv", ADDRESS_OF(glIndexfv));
+    addLibProcedure("glIndexi", ADDRESS_OF(glIndexi));
+    addLibProcedure("glIndexiv", ADDRESS_OF(glIndexiv));
+    addLibProcedure("glIndexs", ADDRESS_OF(glIndexs));
+    addLibProcedure("glIndexsv", ADDRESS_OF(glIndexsv));
+    addLibProcedure("glInitNames", ADDRESS_OF(glInitNames));
+    addLibProcedure("glIsEnabled", ADDRESS_OF(glIsEnabled));
+    addLibProcedure("glIsList", ADDRESS_OF(glIsList));
+    addLibProcedure("glLightModelf", ADDRESS_OF(glLightModelf));
+    addLibProcedure("glLightModelfv", ADDRESS_OF(glLightModelfv));
+    addLibProcedure("glLightModeli", ADDRESS_OF(glLightModeli));
+    addLibProcedure("glLightModeliv", ADDRESS_OF(glLightModeliv));
+    addLibProcedure("glLightf", ADDRESS_OF(glLightf));
+    addLibProcedure("glLightfv", ADDRESS_OF(glLightfv));
+    addLibProcedure("glLighti", ADDRESS_OF(glLighti));
+    addLibProcedure("glLightiv", ADDRESS_OF(glLightiv));
+    addLibProcedure("glLineStipple", ADDRESS_OF(glLineStipple));
+    addLibProcedure("glLineWidth", ADDRESS_OF(glLineWidth));
+    addLibProcedure("glListBase", ADDRESS_OF(glListBase));
+    addLibProcedure("glLoadIdentity", ADDRESS_OF(glLoadIdentity));
+    addLibProcedure("glLoadMatrixd", ADDRESS_OF(glLoadMatrixd));
+    addLibProcedure("glLoadMatrixf", ADDRESS_OF(glLoadMatrixf));
+    addLibProcedure("glLoadName", ADDRESS_OF(glLoadName));
+    addLibProcedure("glLogicOp", ADDRESS_OF(glLogicOp));
+    addLibProcedure("glMap1d", ADDRESS_OF(glMap1d));
+    addLibProcedure("glMap1f", ADDRESS_OF(glMap1f));
+    addLibProcedure("glMap2d", ADDRESS_OF(glMap2d));
+    addLibProcedure("glMap2f", ADDRESS_OF(glMap2f));
+    addLibProcedure("glMapGrid1d", ADDRESS_OF(glMapGrid1d));
+    addLibProcedure("glMapGrid1f", ADDRESS_OF(glMapGrid1f));
+    addLibProcedure("glMapGrid2d", ADDRESS_OF(glMapGrid2d));
+    addLibProcedure("glMapGrid2f", ADDRESS_OF(glMapGrid2f));
+    addLibProcedure("glMaterialf", ADDRESS_OF(glMaterialf));
+    addLibProcedure("glMaterialfv", ADDRESS_OF(glMaterialfv));
+    addLibProcedure("glMateriali", ADDRESS_OF(glMateriali));
+    addLibProcedure("glMaterialiv", ADDRESS_OF(glMaterialiv));
+    addLibProcedure("glMatrixMode", ADDRESS_OF(glMatrixMode));
+    addLibProcedure("glMultMatrixd", ADDRESS_OF(glMultMatrixd));
+    addLibProcedure("glMultMatrixf", ADDRESS_OF(glMultMatrixf));
+    addLibProcedure("glNewList", ADDRESS_OF(glNewList));
+    addLibProcedure("glNormal3b", ADDRESS_OF(glNormal3b));
+    addLibProcedure("glNormal3bv", ADDRESS_OF(glNormal3bv));
+    addLibProcedure("glNormal3d", ADDRESS_OF(glNormal3d));
+    addLibProcedure("glNormal3dv", ADDRESS_OF(glNormal3dv));
+    addLibProcedure("glNormal3f", ADDRESS_OF(glNormal3f));
+    addLibProcedure("glNormal3fv", ADDRESS_OF(glNormal3fv));
+    addLibProcedure("glNormal3i", ADDRESS_OF(glNormal3i));
+    addLibProcedure("glNormal3iv", ADDRESS_OF(glNormal3iv));
+    addLibProcedure("glNormal3s", ADDRESS_OF(glNormal3s));
+    addLibProcedure("glNormal3sv", ADDRESS_OF(glNormal3sv));
+    addLibProcedure("glOrtho", ADDRESS_OF(glOrtho));
+    addLibProcedure("glPassThrough", ADDRESS_OF(glPassThrough));
+    addLibProcedure("glPixelMapfv", ADDRESS_OF(glPixelMapfv));
+    addLibProcedure("glPixelMapuiv", ADDRESS_OF(glPixelMapuiv));
+    addLibProcedure("glPixelMapusv", ADDRESS_OF(glPixelMapusv));
+    addLibProcedure("glPixelStoref", ADDRESS_OF(glPixelStoref));
+    addLibProcedure("glPixelStorei", ADDRESS_OF(glPixelStorei));
+    addLibProcedure("glPixelTransferf", ADDRESS_OF(glPixelTransferf));
+    addLibProcedure("glPixelTransferi", ADDRESS_OF(glPixelTransferi));
+    addLibProcedure("glPixelZoom", ADDRESS_OF(glPixelZoom));
+    addLibProcedure("glPointSize", ADDRESS_OF(glPointSize));
+    addLibProcedure("glPolygonMode", ADDRESS_OF(glPolygonMode));
+    addLibProcedure("glPolygonStipple", ADDRESS_OF(glPolygonStipple));
+    addLibProcedure("glPopAttrib", ADDRESS_OF(glPopAttrib));
+    addLibProcedure("glPopMatrix", ADDRESS_OF(glPopMatrix));
+    addLibProcedure("glPopName", ADDRESS_OF(glPopName));
+    addLibProcedure("glPushAttrib", ADDRESS_OF(glPushAttrib));
+    addLibProcedure("glPushMatrix", ADDRESS_OF(glPushMatrix));
+    addLibProcedure("glPushName", ADDRESS_OF(glPushName));
+    addLibProcedure("glRasterPos2d", ADDRESS_OF(glRasterPos2d));
+    addLibProcedure("glRasterPos2dv", ADDRESS_OF(glRasterPos2dv));
+    addLibProcedure("glRasterPos2f", ADDRESS_OF(glRasterPos2f));
+    addLibProcedure("glRasterPos2fv", ADDRESS_OF(glRasterPos2fv));
+    addLibProcedure("glRasterPos2i", ADDRESS_OF(glRasterPos2i));
+    addLibProcedure("glRasterPos2iv", ADDRESS_OF(glRasterPos2iv));
+    addLibProcedure("glRasterPos2s", ADDRESS_OF(glRasterPos2s));
+    addLibProcedure("glRasterPos2sv", ADDRESS_OF(glRasterPos2sv));
+    addLibProcedure("glRasterPos3d", ADDRESS_OF(glRasterPos3d));
+    addLibProcedure("glRasterPos3dv", ADDRESS_OF(glRasterPos3dv));
+    addLibProcedure("glRasterPos3f", ADDRESS_OF(glRasterPos3f));
+    addLibProcedure("glRasterPos3fv", ADDRESS_OF(glRasterPos3fv));
+    addLibProcedure("glRasterPos3i", ADDRESS_OF(glRasterPos3i));
+    addLibProcedure("glRasterPos3iv", ADDRESS_OF(glRasterPos3iv));
+    addLibProcedure("glRasterPos3s", ADDRESS_OF(glRasterPos3s));
+    addLibProcedure("glRasterPos3sv", ADDRESS_OF(glRasterPos3sv));
+    addLibProcedure("glRasterPos4d", ADDRESS_OF(glRasterPos4d));
+    addLibProcedure("glRasterPos4dv", ADDRESS_OF(glRasterPos4dv));
+    addLibProcedure("glRasterPos4f", ADDRESS_OF(glRasterPos4f));
+    addLibProcedure("glRasterPos4fv", ADDRESS_OF(glRasterPos4fv));
+    addLibProcedure("glRasterPos4i", ADDRESS_OF(glRasterPos4i));
+    addLibProcedure("glRasterPos4iv", ADDRESS_OF(glRasterPos4iv));
+    addLibProcedure("glRasterPos4s", ADDRESS_OF(glRasterPos4s));
+    addLibProcedure("glRasterPos4sv", ADDRESS_OF(glRasterPos4sv));
+    addLibProcedure("glReadBuffer", ADDRESS_OF(glReadBuffer));
+    addLibProcedure("glReadPixels", ADDRESS_OF(glReadPixels));
+    addLibProcedure("glRectd", ADDRESS_OF(glRectd));
+    addLibProcedure("glRectdv", ADDRESS_OF(glRectdv));
+    addLibProcedure("glRectf", ADDRESS_OF(glRectf));
+    addLibProcedure("glRectfv", ADDRESS_OF(glRectfv));
+    addLibProcedure("glRecti", ADDRESS_OF(glRecti));
+    addLibProcedure("glRectiv", ADDRESS_OF(glRectiv));
+    addLibProcedure("glRects", ADDRESS_OF(glRects));
+    addLibProcedure("glRectsv", ADDRESS_OF(glRectsv));
+    addLibProcedure("glRenderMode", ADDRESS_OF(glRenderMode));
+    addLibProcedure("glRotated", ADDRESS_OF(glRotated));
+    addLibProcedure("glRotatef", ADDRESS_OF(glRotatef));
+    addLibProcedure("glScaled", ADDRESS_OF(glScaled));
+    addLibProcedure("glScalef", ADDRESS_OF(glScalef));
+    addLibProcedure("glScissor", ADDRESS_OF(glScissor));
+    addLibProcedure("glSelectBuffer", ADDRESS_OF(glSelectBuffer));
+    addLibProcedure("glShadeModel", ADDRESS_OF(glShadeModel));
+    addLibProcedure("glStencilFunc", ADDRESS_OF(glStencilFunc));
+    addLibProcedure("glStencilMask", ADDRESS_OF(glStencilMask));
+    addLibProcedure("glStencilOp", ADDRESS_OF(glStencilOp));
+    addLibProcedure("glTexCoord1d", ADDRESS_OF(glTexCoord1d));
+    addLibProcedure("glTexCoord1dv", ADDRESS_OF(glTexCoord1dv));
+    addLibProcedure("glTexCoord1f", ADDRESS_OF(glTexCoord1f));
+    addLibProcedure("glTexCoord1fv", ADDRESS_OF(glTexCoord1fv));
+    addLibProcedure("glTexCoord1i", ADDRESS_OF(glTexCoord1i));
+    addLibProcedure("glTexCoord1iv", ADDRESS_OF(glTexCoord1iv));
+    addLibProcedure("glTexCoord1s", ADDRESS_OF(glTexCoord1s));
+    addLibProcedure("glTexCoord1sv", ADDRESS_OF(glTexCoord1sv));
+    addLibProcedure("glTexCoord2d", ADDRESS_OF(glTexCoord2d));
+    addLibProcedure("glTexCoord2dv", ADDRESS_OF(glTexCoord2dv));
+    addLibProcedure("glTexCoord2f", ADDRESS_OF(glTexCoord2f));
+    addLibProcedure("glTexCoord2fv", ADDRESS_OF(glTexCoord2fv));
+    addLibProcedure("glTexCoord2i", ADDRESS_OF(glTexCoord2i));
+    addLibProcedure("glTexCoord2iv", ADDRESS_OF(glTexCoord2iv));
+    addLibProcedure("glTexCoord2s", ADDRESS_OF(glTexCoord2s));
+    addLibProcedure("glTexCoord2sv", ADDRESS_OF(glTexCoord2sv));
+    addLibProcedure("glTexCoord3d", ADDRESS_OF(glTexCoord3d));
+    addLibProcedure("glTexCoord3dv", ADDRESS_OF(glTexCoord3dv));
+    addLibProcedure("glTexCoord3f", ADDRESS_OF(glTexCoord3f));
+    addLibProcedure("glTexCoord3fv", ADDRESS_OF(glTexCoord3fv));
+    addLibProcedure("glTexCoord3i", ADDRESS_OF(glTexCoord3i));
+    addLibProcedure("glTexCoord3iv", ADDRESS_OF(glTexCoord3iv));
+    addLibProcedure("glTexCoord3s", ADDRESS_OF(glTexCoord3s));
+    addLibProcedure("glTexCoord3sv", ADDRESS_OF(glTexCoord3sv));
+    addLibProcedure("glTexCoord4d", ADDRESS_OF(glTexCoord4d));
+    addLibProcedure("glTexCoord4dv", ADDRESS_OF(glTexCoord4dv));
+    addLibProcedure("glTexCoord4f", ADDRESS_OF(glTexCoord4f));
+    addLibProcedure("glTexCoord4fv", ADDRESS_OF(glTexCoord4fv));
+    addLibProcedure("glTexCoord4i", ADDRESS_OF(glTexCoord4i));
+    addLibProcedure("glTexCoord4iv", ADDRESS_OF(glTexCoord4iv));
+    addLibProcedure("glTexCoord4s", ADDRESS_OF(glTexCoord4s));
+    addLibProcedure("glTexCoord4sv", ADDRESS_OF(glTexCoord4sv));
+    addLibProcedure("glTexEnvf", ADDRESS_OF(glTexEnvf));
+    addLibProcedure("glTexEnvfv", ADDRESS_OF(glTexEnvfv));
+    addLibProcedure("glTexEnvi", ADDRESS_OF(glTexEnvi));
+    addLibProcedure("glTexEnviv", ADDRESS_OF(glTexEnviv));
+    addLibProcedure("glTexGend", ADDRESS_OF(glTexGend));
+    addLibProcedure("glTexGendv", ADDRESS_OF(glTexGendv));
+    addLibProcedure("glTexGenf", ADDRESS_OF(glTexGenf));
+    addLibProcedure("glTexGenfv", ADDRESS_OF(glTexGenfv));
+    addLibProcedure("glTexGeni", ADDRESS_OF(glTexGeni));
+    addLibProcedure("glTexGeniv", ADDRESS_OF(glTexGeniv));
+    addLibProcedure("glTexImage1D", ADDRESS_OF(glTexImage1D));
+    addLibProcedure("glTexImage2D", ADDRESS_OF(glTexImage2D));
+    addLibProcedure("glTexParameterf", ADDRESS_OF(glTexParameterf));
+    addLibProcedure("glTexParameterfv", ADDRESS_OF(glTexParameterfv));
+    addLibProcedure("glTexParameteri", ADDRESS_OF(glTexParameteri));
+    addLibProcedure("glTexParameteriv", ADDRESS_OF(glTexParameteriv));
+    addLibProcedure("glTranslated", ADDRESS_OF(glTranslated));
+    addLibProcedure("glTranslatef", ADDRESS_OF(glTranslatef));
+    addLibProcedure("glVertex2d", ADDRESS_OF(glVertex2d));
+    addLibProcedure("glVertex2dv", ADDRESS_OF(glVertex2dv));
+    addLibProcedure("glVertex2f", ADDRESS_OF(glVertex2f));
+    addLibProcedure("glVertex2fv", ADDRESS_OF(glVertex2fv));
+    addLibProcedure("glVertex2i", ADDRESS_OF(glVertex2i));
+    addLibProcedure("glVertex2iv", ADDRESS_OF(glVertex2iv));
+    addLibProcedure("glVertex2s", ADDRESS_OF(glVertex2s));
+    addLibProcedure("glVertex2sv", ADDRESS_OF(glVertex2sv));
+    addLibProcedure("glVertex3d", ADDRESS_OF(glVertex3d));
+    addLibProcedure("glVertex3dv", ADDRESS_OF(glVertex3dv));
+    addLibProcedure("glVertex3f", ADDRESS_OF(glVertex3f));
+    addLibProcedure("glVertex3fv", ADDRESS_OF(glVertex3fv));
+    addLibProcedure("glVertex3i", ADDRESS_OF(glVertex3i));
+    addLibProcedure("glVertex3iv", ADDRESS_OF(glVertex3iv));
+    addLibProcedure("glVertex3s", ADDRESS_OF(glVertex3s));
+    addLibProcedure("glVertex3sv", ADDRESS_OF(glVertex3sv));
+    addLibProcedure("glVertex4d", ADDRESS_OF(glVertex4d));
+    addLibProcedure("glVertex4dv", ADDRESS_OF(glVertex4dv));
+    addLibProcedure("glVertex4f", ADDRESS_OF(glVertex4f));
+    addLibProcedure("glVertex4fv", ADDRESS_OF(glVertex4fv));
+    addLibProcedure("glVertex4i", ADDRESS_OF(glVertex4i));
+    addLibProcedure("glVertex4iv", ADDRESS_OF(glVertex4iv));
+    addLibProcedure("glVertex4s", ADDRESS_OF(glVertex4s));
+    addLibProcedure("glVertex4sv", ADDRESS_OF(glVertex4sv));
+    addLibProcedure("glViewport", ADDRESS_OF(glViewport));
 
     // Register Open GL 1.1 procedures
-    addLibProcedure("glAreTexturesResident", ADDRESS_OF(impl_glAreTexturesResident));
-    addLibProcedure("glArrayElement", ADDRESS_OF(impl_glArrayElement));
-    addLibProcedure("glBindTexture", ADDRESS_OF(impl_glBindTexture));
-    addLibProcedure("glColorPointer", ADDRESS_OF(impl_glColorPointer));
-    addLibProcedure("glCopyTexImage1D", ADDRESS_OF(impl_glCopyTexImage1D));
-    addLibProcedure("glCopyTexImage2D", ADDRESS_OF(impl_glCopyTexImage2D));
-    addLibProcedure("glCopyTexSubImage1D", ADDRESS_OF(impl_glCopyTexSubImage1D));
-    addLibProcedure("glCopyTexSubImage2D", ADDRESS_OF(impl_glCopyTexSubImage2D));
-    addLibProcedure("glDeleteTextures", ADDRESS_OF(impl_glDeleteTextures));
-    addLibProcedure("glDisableClientState", ADDRESS_OF(impl_glDisableClientState));
-    addLibProcedure("glDrawArrays", ADDRESS_OF(impl_glDrawArrays));
-    addLibProcedure("glDrawElements", ADDRESS_OF(impl_glDrawElements));
-    addLibProcedure("glEdgeFlagPointer", ADDRESS_OF(impl_glEdgeFlagPointer));
-    addLibProcedure("glEnableClientState", ADDRESS_OF(impl_glEnableClientState));
-    addLibProcedure("glGenTextures", ADDRESS_OF(impl_glGenTextures));
-    addLibProcedure("glGetPointerv", ADDRESS_OF(impl_glGetPointerv));
-    addLibProcedure("glIsTexture", ADDRESS_OF(impl_glIsTexture));
-    addLibProcedure("glIndexPointer", ADDRESS_OF(impl_glIndexPointer));
-    addLibProcedure("glIndexub", ADDRESS_OF(impl_glIndexub));
-    addLibProcedure("glIndexubv", ADDRESS_OF(impl_glIndexubv));
-    addLibProcedure("glInterleavedArrays", ADDRESS_OF(impl_glInterleavedArrays));
-    addLibProcedure("glNormalPointer", ADDRESS_OF(impl_glNormalPointer));
-    addLibProcedure("glPolygonOffset", ADDRESS_OF(impl_glPolygonOffset));
-    addLibProcedure("glPopClientAttrib", ADDRESS_OF(impl_glPopClientAttrib));
-    addLibProcedure("glPrioritizeTextures", ADDRESS_OF(impl_glPrioritizeTextures));
-    addLibProcedure("glPushClientAttrib", ADDRESS_OF(impl_glPushClientAttrib));
-    addLibProcedure("glTexCoordPointer", ADDRESS_OF(impl_glTexCoordPointer));
-    addLibProcedure("glTexSubImage1D", ADDRESS_OF(impl_glTexSubImage1D));
-    addLibProcedure("glTexSubImage2D", ADDRESS_OF(impl_glTexSubImage2D));
-    addLibProcedure("glVertexPointer", ADDRESS_OF(impl_glVertexPointer));
+    addLibProcedure("glAreTexturesResident", ADDRESS_OF(glAreTexturesResident));
+    addLibProcedure("glArrayElement", ADDRESS_OF(glArrayElement));
+    addLibProcedure("glBindTexture", ADDRESS_OF(glBindTexture));
+    addLibProcedure("glColorPointer", ADDRESS_OF(glColorPointer));
+    addLibProcedure("glCopyTexImage1D", ADDRESS_OF(glCopyTexImage1D));
+    addLibProcedure("glCopyTexImage2D", ADDRESS_OF(glCopyTexImage2D));
+    addLibProcedure("glCopyTexSubImage1D", ADDRESS_OF(glCopyTexSubImage1D));
+    addLibProcedure("glCopyTexSubImage2D", ADDRESS_OF(glCopyTexSubImage2D));
+    addLibProcedure("glDeleteTextures", ADDRESS_OF(glDeleteTextures));
+    addLibProcedure("glDisableClientState", ADDRESS_OF(glDisableClientState));
+    addLibProcedure("glDrawArrays", ADDRESS_OF(glDrawArrays));
+    addLibProcedure("glDrawElements", ADDRESS_OF(glDrawElements));
+    addLibProcedure("glEdgeFlagPointer", ADDRESS_OF(glEdgeFlagPointer));
+    addLibProcedure("glEnableClientState", ADDRESS_OF(glEnableClientState));
+    addLibProcedure("glGenTextures", ADDRESS_OF(glGenTextures));
+    addLibProcedure("glGetPointerv", ADDRESS_OF(glGetPointerv));
+    addLibProcedure("glIsTexture", ADDRESS_OF(glIsTexture));
+    addLibProcedure("glIndexPointer", ADDRESS_OF(glIndexPointer));
+    addLibProcedure("glIndexub", ADDRESS_OF(glIndexub));
+    addLibProcedure("glIndexubv", ADDRESS_OF(glIndexubv));
+    addLibProcedure("glInterleavedArrays", ADDRESS_OF(glInterleavedArrays));
+    addLibProcedure("glNormalPointer", ADDRESS_OF(glNormalPointer));
+    addLibProcedure("glPolygonOffset", ADDRESS_OF(glPolygonOffset));
+    addLibProcedure("glPopClientAttrib", ADDRESS_OF(glPopClientAttrib));
+    addLibProcedure("glPrioritizeTextures", ADDRESS_OF(glPrioritizeTextures));
+    addLibProcedure("glPushClientAttrib", ADDRESS_OF(glPushClientAttrib));
+    addLibProcedure("glTexCoordPointer", ADDRESS_OF(glTexCoordPointer));
+    addLibProcedure("glTexSubImage1D", ADDRESS_OF(glTexSubImage1D));
+    addLibProcedure("glTexSubImage2D", ADDRESS_OF(glTexSubImage2D));
+    addLibProcedure("glVertexPointer", ADDRESS_OF(glVertexPointer));
 
     // Register Open GL 1.2 procedures
-    addLibProcedure("glDrawRangeElements", ADDRESS_OF(impl_glDrawRangeElements));
-    addLibProcedure("glTexImage3D", ADDRESS_OF(impl_glTexImage3D));
-    addLibProcedure("glTexSubImage3D", ADDRESS_OF(impl_glTexSubImage3D));
-    addLibProcedure("glCopyTexSubImage3D", ADDRESS_OF(impl_glCopyTexSubImage3D));
+    addLibProcedure("glDrawRangeElements", ADDRESS_OF(glDrawRangeElements));
+    addLibProcedure("glTexImage3D", ADDRESS_OF(glTexImage3D));
+    addLibProcedure("glTexSubImage3D", ADDRESS_OF(glTexSubImage3D));
+    addLibProcedure("glCopyTexSubImage3D", ADDRESS_OF(glCopyTexSubImage3D));
 
     // Register Open GL 1.3 procedures
-    addLibProcedure("glActiveTexture", ADDRESS_OF(impl_glActiveTexture));
-    addLibProcedure("glSampleCoverage", ADDRESS_OF(impl_glSampleCoverage));
-    addLibProcedure("glCompressedTexImage3D", ADDRESS_OF(impl_glCompressedTexImage3D));
-    addLibProcedure("glCompressedTexImage2D", ADDRESS_OF(impl_glCompressedTexImage2D));
-    addLibProcedure("glCompressedTexImage1D", ADDRESS_OF(impl_glCompressedTexImage1D));
-    addLibProcedure("glCompressedTexSubImage3D", ADDRESS_OF(impl_glCompressedTexSubImage3D));
-    addLibProcedure("glCompressedTexSubImage2D", ADDRESS_OF(impl_glCompressedTexSubImage2D));
-    addLibProcedure("glCompressedTexSubImage1D", ADDRESS_OF(impl_glCompressedTexSubImage1D));
-    addLibProcedure("glGetCompressedTexImage", ADDRESS_OF(impl_glGetCompressedTexImage));
-    addLibProcedure("glClientActiveTexture", ADDRESS_OF(impl_glClientActiveTexture));
-    addLibProcedure("glMultiTexCoord1d", ADDRESS_OF(impl_glMultiTexCoord1d));
-    addLibProcedure("glMultiTexCoord1dv", ADDRESS_OF(impl_glMultiTexCoord1dv));
-    addLibProcedure("glMultiTexCoord1f", ADDRESS_OF(impl_glMultiTexCoord1f));
-    addLibProcedure("glMultiTexCoord1fv", ADDRESS_OF(impl_glMultiTexCoord1fv));
-    addLibProcedure("glMultiTexCoord1i", ADDRESS_OF(impl_glMultiTexCoord1i));
-    addLibProcedure("glMultiTexCoord1iv", ADDRESS_OF(impl_glMultiTexCoord1iv));
-    addLibProcedure("glMultiTexCoord1s", ADDRESS_OF(impl_glMultiTexCoord1s));
-    addLibProcedure("glMultiTexCoord1sv", ADDRESS_OF(impl_glMultiTexCoord1sv));
-    addLibProcedure("glMultiTexCoord2d", ADDRESS_OF(impl_glMultiTexCoord2d));
-    addLibProcedure("glMultiTexCoord2dv", ADDRESS_OF(impl_glMultiTexCoord2dv));
-    addLibProcedure("glMultiTexCoord2f", ADDRESS_OF(impl_glMultiTexCoord2f));
-    addLibProcedure("glMultiTexCoord2fv", ADDRESS_OF(impl_glMultiTexCoord2fv));
-    addLibProcedure("glMultiTexCoord2i", ADDRESS_OF(impl_glMultiTexCoord2i));
-    addLibProcedure("glMultiTexCoord2iv", ADDRESS_OF(impl_glMultiTexCoord2iv));
-    addLibProcedure("glMultiTexCoord2s", ADDRESS_OF(impl_glMultiTexCoord2s));
-    addLibProcedure("glMultiTexCoord2sv", ADDRESS_OF(impl_glMultiTexCoord2sv));
-    addLibProcedure("glMultiTexCoord3d", ADDRESS_OF(impl_glMultiTexCoord3d));
-    addLibProcedure("glMultiTexCoord3dv", ADDRESS_OF(impl_glMultiTexCoord3dv));
-    addLibProcedure("glMultiTexCoord3f", ADDRESS_OF(impl_glMultiTexCoord3f));
-    addLibProcedure("glMultiTexCoord3fv", ADDRESS_OF(impl_glMultiTexCoord3fv));
-    addLibProcedure("glMultiTexCoord3i", ADDRESS_OF(impl_glMultiTexCoord3i));
-    addLibProcedure("glMultiTexCoord3iv", ADDRESS_OF(impl_glMultiTexCoord3iv));
-    addLibProcedure("glMultiTexCoord3s", ADDRESS_OF(impl_glMultiTexCoord3s));
-    addLibProcedure("glMultiTexCoord3sv", ADDRESS_OF(impl_glMultiTexCoord3sv));
-    addLibProcedure("glMultiTexCoord4d", ADDRESS_OF(impl_glMultiTexCoord4d));
-    addLibProcedure("glMultiTexCoord4dv", ADDRESS_OF(impl_glMultiTexCoord4dv));
-    addLibProcedure("glMultiTexCoord4f", ADDRESS_OF(impl_glMultiTexCoord4f));
-    addLibProcedure("glMultiTexCoord4fv", ADDRESS_OF(impl_glMultiTexCoord4fv));
-    addLibProcedure("glMultiTexCoord4i", ADDRESS_OF(impl_glMultiTexCoord4i));
-    addLibProcedure("glMultiTexCoord4iv", ADDRESS_OF(impl_glMultiTexCoord4iv));
-    addLibProcedure("glMultiTexCoord4s", ADDRESS_OF(impl_glMultiTexCoord4s));
-    addLibProcedure("glMultiTexCoord4sv", ADDRESS_OF(impl_glMultiTexCoord4sv));
-    addLibProcedure("glLoadTransposeMatrixf", ADDRESS_OF(impl_glLoadTransposeMatrixf));
-    addLibProcedure("glLoadTransposeMatrixd", ADDRESS_OF(impl_glLoadTransposeMatrixd));
-    addLibProcedure("glMultTransposeMatrixf", ADDRESS_OF(impl_glMultTransposeMatrixf));
-    addLibProcedure("glMultTransposeMatrixd", ADDRESS_OF(impl_glMultTransposeMatrixd));
+    addLibProcedure("glActiveTexture", ADDRESS_OF(glActiveTexture));
+    addLibProcedure("glSampleCoverage", ADDRESS_OF(glSampleCoverage));
+    addLibProcedure("glCompressedTexImage3D", ADDRESS_OF(glCompressedTexImage3D));
+    addLibProcedure("glCompressedTexImage2D", ADDRESS_OF(glCompressedTexImage2D));
+    addLibProcedure("glCompressedTexImage1D", ADDRESS_OF(glCompressedTexImage1D));
+    addLibProcedure("glCompressedTexSubImage3D", ADDRESS_OF(glCompressedTexSubImage3D));
+    addLibProcedure("glCompressedTexSubImage2D", ADDRESS_OF(glCompressedTexSubImage2D));
+    addLibProcedure("glCompressedTexSubImage1D", ADDRESS_OF(glCompressedTexSubImage1D));
+    addLibProcedure("glGetCompressedTexImage", ADDRESS_OF(glGetCompressedTexImage));
+    addLibProcedure("glClientActiveTexture", ADDRESS_OF(glClientActiveTexture));
+    addLibProcedure("glMultiTexCoord1d", ADDRESS_OF(glMultiTexCoord1d));
+    addLibProcedure("glMultiTexCoord1dv", ADDRESS_OF(glMultiTexCoord1dv));
+    addLibProcedure("glMultiTexCoord1f", ADDRESS_OF(glMultiTexCoord1f));
+    addLibProcedure("glMultiTexCoord1fv", ADDRESS_OF(glMultiTexCoord1fv));
+    addLibProcedure("glMultiTexCoord1i", ADDRESS_OF(glMultiTexCoord1i));
+    addLibProcedure("glMultiTexCoord1iv", ADDRESS_OF(glMultiTexCoord1iv));
+    addLibProcedure("glMultiTexCoord1s", ADDRESS_OF(glMultiTexCoord1s));
+    addLibProcedure("glMultiTexCoord1sv", ADDRESS_OF(glMultiTexCoord1sv));
+    addLibProcedure("glMultiTexCoord2d", ADDRESS_OF(glMultiTexCoord2d));
+    addLibProcedure("glMultiTexCoord2dv", ADDRESS_OF(glMultiTexCoord2dv));
+    addLibProcedure("glMultiTexCoord2f", ADDRESS_OF(glMultiTexCoord2f));
+    addLibProcedure("glMultiTexCoord2fv", ADDRESS_OF(glMultiTexCoord2fv));
+    addLibProcedure("glMultiTexCoord2i", ADDRESS_OF(glMultiTexCoord2i));
+    addLibProcedure("glMultiTexCoord2iv", ADDRESS_OF(glMultiTexCoord2iv));
+    addLibProcedure("glMultiTexCoord2s", ADDRESS_OF(glMultiTexCoord2s));
+    addLibProcedure("glMultiTexCoord2sv", ADDRESS_OF(glMultiTexCoord2sv));
+    addLibProcedure("glMultiTexCoord3d", ADDRESS_OF(glMultiTexCoord3d));
+    addLibProcedure("glMultiTexCoord3dv", ADDRESS_OF(glMultiTexCoord3dv));
+    addLibProcedure("glMultiTexCoord3f", ADDRESS_OF(glMultiTexCoord3f));
+    addLibProcedure("glMultiTexCoord3fv", ADDRESS_OF(glMultiTexCoord3fv));
+    addLibProcedure("glMultiTexCoord3i", ADDRESS_OF(glMultiTexCoord3i));
+    addLibProcedure("glMultiTexCoord3iv", ADDRESS_OF(glMultiTexCoord3iv));
+    addLibProcedure("glMultiTexCoord3s", ADDRESS_OF(glMultiTexCoord3s));
+    addLibProcedure("glMultiTexCoord3sv", ADDRESS_OF(glMultiTexCoord3sv));
+    addLibProcedure("glMultiTexCoord4d", ADDRESS_OF(glMultiTexCoord4d));
+    addLibProcedure("glMultiTexCoord4dv", ADDRESS_OF(glMultiTexCoord4dv));
+    addLibProcedure("glMultiTexCoord4f", ADDRESS_OF(glMultiTexCoord4f));
+    addLibProcedure("glMultiTexCoord4fv", ADDRESS_OF(glMultiTexCoord4fv));
+    addLibProcedure("glMultiTexCoord4i", ADDRESS_OF(glMultiTexCoord4i));
+    addLibProcedure("glMultiTexCoord4iv", ADDRESS_OF(glMultiTexCoord4iv));
+    addLibProcedure("glMultiTexCoord4s", ADDRESS_OF(glMultiTexCoord4s));
+    addLibProcedure("glMultiTexCoord4sv", ADDRESS_OF(glMultiTexCoord4sv));
+    addLibProcedure("glLoadTransposeMatrixf", ADDRESS_OF(glLoadTransposeMatrixf));
+    addLibProcedure("glLoadTransposeMatrixd", ADDRESS_OF(glLoadTransposeMatrixd));
+    addLibProcedure("glMultTransposeMatrixf", ADDRESS_OF(glMultTransposeMatrixf));
+    addLibProcedure("glMultTransposeMatrixd", ADDRESS_OF(glMultTransposeMatrixd));
 
     // Register the implemented extensions
     addLibExtension("GL_ARB_texture_env_add");
@@ -510,53 +539,75 @@ RIXGL::RIXGL(IBusConnector& busConnector, IThreadRunner& runner)
     addLibExtension("GL_ARB_multitexture");
     {
 
-        addLibProcedure("glMultiTexCoord1dARB", ADDRESS_OF(impl_glMultiTexCoord1d));
-        addLibProcedure("glMultiTexCoord1dvARB", ADDRESS_OF(impl_glMultiTexCoord1dv));
-        addLibProcedure("glMultiTexCoord1fARB", ADDRESS_OF(impl_glMultiTexCoord1f));
-        addLibProcedure("glMultiTexCoord1fvARB", ADDRESS_OF(impl_glMultiTexCoord1fv));
-        addLibProcedure("glMultiTexCoord1iARB", ADDRESS_OF(impl_glMultiTexCoord1i));
-        addLibProcedure("glMultiTexCoord1ivARB", ADDRESS_OF(impl_glMultiTexCoord1iv));
-        addLibProcedure("glMultiTexCoord1sARB", ADDRESS_OF(impl_glMultiTexCoord1s));
-        addLibProcedure("glMultiTexCoord1svARB", ADDRESS_OF(impl_glMultiTexCoord1sv));
-        addLibProcedure("glMultiTexCoord2dARB", ADDRESS_OF(impl_glMultiTexCoord2d));
-        addLibProcedure("glMultiTexCoord2dvARB", ADDRESS_OF(impl_glMultiTexCoord2dv));
-        addLibProcedure("glMultiTexCoord2fARB", ADDRESS_OF(impl_glMultiTexCoord2f));
-        addLibProcedure("glMultiTexCoord2fvARB", ADDRESS_OF(impl_glMultiTexCoord2fv));
-        addLibProcedure("glMultiTexCoord2iARB", ADDRESS_OF(impl_glMultiTexCoord2i));
-        addLibProcedure("glMultiTexCoord2ivARB", ADDRESS_OF(impl_glMultiTexCoord2iv));
-        addLibProcedure("glMultiTexCoord2sARB", ADDRESS_OF(impl_glMultiTexCoord2s));
-        addLibProcedure("glMultiTexCoord2svARB", ADDRESS_OF(impl_glMultiTexCoord2sv));
-        addLibProcedure("glMultiTexCoord3dARB", ADDRESS_OF(impl_glMultiTexCoord3d));
-        addLibProcedure("glMultiTexCoord3dvARB", ADDRESS_OF(impl_glMultiTexCoord3dv));
-        addLibProcedure("glMultiTexCoord3fARB", ADDRESS_OF(impl_glMultiTexCoord3f));
-        addLibProcedure("glMultiTexCoord3fvARB", ADDRESS_OF(impl_glMultiTexCoord3fv));
-        addLibProcedure("glMultiTexCoord3iARB", ADDRESS_OF(impl_glMultiTexCoord3i));
-        addLibProcedure("glMultiTexCoord3ivARB", ADDRESS_OF(impl_glMultiTexCoord3iv));
-        addLibProcedure("glMultiTexCoord3sARB", ADDRESS_OF(impl_glMultiTexCoord3s));
-        addLibProcedure("glMultiTexCoord3svARB", ADDRESS_OF(impl_glMultiTexCoord3sv));
-        addLibProcedure("glMultiTexCoord4dARB", ADDRESS_OF(impl_glMultiTexCoord4d));
-        addLibProcedure("glMultiTexCoord4dvARB", ADDRESS_OF(impl_glMultiTexCoord4dv));
-        addLibProcedure("glMultiTexCoord4fARB", ADDRESS_OF(impl_glMultiTexCoord4f));
-        addLibProcedure("glMultiTexCoord4fvARB", ADDRESS_OF(impl_glMultiTexCoord4fv));
-        addLibProcedure("glMultiTexCoord4iARB", ADDRESS_OF(impl_glMultiTexCoord4i));
-        addLibProcedure("glMultiTexCoord4ivARB", ADDRESS_OF(impl_glMultiTexCoord4iv));
-        addLibProcedure("glMultiTexCoord4sARB", ADDRESS_OF(impl_glMultiTexCoord4s));
-        addLibProcedure("glMultiTexCoord4svARB", ADDRESS_OF(impl_glMultiTexCoord4sv));
-        addLibProcedure("glActiveTextureARB", ADDRESS_OF(impl_glActiveTexture));
-        addLibProcedure("glClientActiveTextureARB", ADDRESS_OF(impl_glClientActiveTexture));
+        addLibProcedure("glMultiTexCoord1dARB", ADDRESS_OF(glMultiTexCoord1d));
+        addLibProcedure("glMultiTexCoord1dvARB", ADDRESS_OF(glMultiTexCoord1dv));
+        addLibProcedure("glMultiTexCoord1fARB", ADDRESS_OF(glMultiTexCoord1f));
+        addLibProcedure("glMultiTexCoord1fvARB", ADDRESS_OF(glMultiTexCoord1fv));
+        addLibProcedure("glMultiTexCoord1iARB", ADDRESS_OF(glMultiTexCoord1i));
+        addLibProcedure("glMultiTexCoord1ivARB", ADDRESS_OF(glMultiTexCoord1iv));
+        addLibProcedure("glMultiTexCoord1sARB", ADDRESS_OF(glMultiTexCoord1s));
+        addLibProcedure("glMultiTexCoord1svARB", ADDRESS_OF(glMultiTexCoord1sv));
+        addLibProcedure("glMultiTexCoord2dARB", ADDRESS_OF(glMultiTexCoord2d));
+        addLibProcedure("glMultiTexCoord2dvARB", ADDRESS_OF(glMultiTexCoord2dv));
+        addLibProcedure("glMultiTexCoord2fARB", ADDRESS_OF(glMultiTexCoord2f));
+        addLibProcedure("glMultiTexCoord2fvARB", ADDRESS_OF(glMultiTexCoord2fv));
+        addLibProcedure("glMultiTexCoord2iARB", ADDRESS_OF(glMultiTexCoord2i));
+        addLibProcedure("glMultiTexCoord2ivARB", ADDRESS_OF(glMultiTexCoord2iv));
+        addLibProcedure("glMultiTexCoord2sARB", ADDRESS_OF(glMultiTexCoord2s));
+        addLibProcedure("glMultiTexCoord2svARB", ADDRESS_OF(glMultiTexCoord2sv));
+        addLibProcedure("glMultiTexCoord3dARB", ADDRESS_OF(glMultiTexCoord3d));
+        addLibProcedure("glMultiTexCoord3dvARB", ADDRESS_OF(glMultiTexCoord3dv));
+        addLibProcedure("glMultiTexCoord3fARB", ADDRESS_OF(glMultiTexCoord3f));
+        addLibProcedure("glMultiTexCoord3fvARB", ADDRESS_OF(glMultiTexCoord3fv));
+        addLibProcedure("glMultiTexCoord3iARB", ADDRESS_OF(glMultiTexCoord3i));
+        addLibProcedure("glMultiTexCoord3ivARB", ADDRESS_OF(glMultiTexCoord3iv));
+        addLibProcedure("glMultiTexCoord3sARB", ADDRESS_OF(glMultiTexCoord3s));
+        addLibProcedure("glMultiTexCoord3svARB", ADDRESS_OF(glMultiTexCoord3sv));
+        addLibProcedure("glMultiTexCoord4dARB", ADDRESS_OF(glMultiTexCoord4d));
+        addLibProcedure("glMultiTexCoord4dvARB", ADDRESS_OF(glMultiTexCoord4dv));
+        addLibProcedure("glMultiTexCoord4fARB", ADDRESS_OF(glMultiTexCoord4f));
+        addLibProcedure("glMultiTexCoord4fvARB", ADDRESS_OF(glMultiTexCoord4fv));
+        addLibProcedure("glMultiTexCoord4iARB", ADDRESS_OF(glMultiTexCoord4i));
+        addLibProcedure("glMultiTexCoord4ivARB", ADDRESS_OF(glMultiTexCoord4iv));
+        addLibProcedure("glMultiTexCoord4sARB", ADDRESS_OF(glMultiTexCoord4s));
+        addLibProcedure("glMultiTexCoord4svARB", ADDRESS_OF(glMultiTexCoord4sv));
+        addLibProcedure("glActiveTextureARB", ADDRESS_OF(glActiveTexture));
+        addLibProcedure("glClientActiveTextureARB", ADDRESS_OF(glClientActiveTexture));
     }
 
-    addLibProcedure("glLockArrays", ADDRESS_OF(impl_glLockArrays));
-    addLibProcedure("glUnlockArrays", ADDRESS_OF(impl_glUnlockArrays));
-    addLibProcedure("glActiveStencilFaceEXT", ADDRESS_OF(impl_glActiveStencilFaceEXT));
-    addLibProcedure("glBlendEquation", ADDRESS_OF(impl_glBlendEquation));
-    addLibProcedure("glBlendFuncSeparate", ADDRESS_OF(impl_glBlendFuncSeparate));
-    // addLibExtension("GL_EXT_compiled_vertex_array");
-    // {
-
-    //     addLibProcedure("glLockArraysEXT", ADDRESS_OF(impl_glLockArrays));
-    //     addLibProcedure("glUnlockArraysEXT", ADDRESS_OF(impl_glUnlockArrays));
-    // }
+    addLibProcedure("glLockArrays", ADDRESS_OF(glLockArrays));
+    addLibProcedure("glUnlockArrays", ADDRESS_OF(glUnlockArrays));
+    addLibProcedure("glActiveStencilFaceEXT", ADDRESS_OF(glActiveStencilFaceEXT));
+    addLibProcedure("glBlendEquation", ADDRESS_OF(glBlendEquation));
+    addLibProcedure("glBlendFuncSeparate", ADDRESS_OF(glBlendFuncSeparate));
+    addLibExtension("GL_EXT_compiled_vertex_array");
+    {
+        addLibProcedure("glLockArraysEXT", ADDRESS_OF(glLockArrays));
+        addLibProcedure("glUnlockArraysEXT", ADDRESS_OF(glUnlockArrays));
+    }
+    addLibProcedure("glBindBuffer", ADDRESS_OF(glBindBuffer));
+    addLibProcedure("glDeleteBuffers", ADDRESS_OF(glDeleteBuffers));
+    addLibProcedure("glGenBuffers", ADDRESS_OF(glGenBuffers));
+    addLibProcedure("glIsBuffer", ADDRESS_OF(glIsBuffer));
+    addLibProcedure("glBufferData", ADDRESS_OF(glBufferData));
+    addLibProcedure("glBufferSubData", ADDRESS_OF(glBufferSubData));
+    addLibProcedure("glGetBufferSubData", ADDRESS_OF(glGetBufferSubData));
+    addLibProcedure("glMapBuffer", ADDRESS_OF(glMapBuffer));
+    addLibProcedure("glUnmapBuffer", ADDRESS_OF(glUnmapBuffer));
+    addLibProcedure("glGetBufferParameteriv", ADDRESS_OF(glGetBufferParameteriv));
+    addLibExtension("GL_ARB_vertex_buffer_object");
+    {
+        addLibProcedure("glBindBufferARB", ADDRESS_OF(glBindBuffer));
+        addLibProcedure("glDeleteBuffersARB", ADDRESS_OF(glDeleteBuffers));
+        addLibProcedure("glGenBuffersARB", ADDRESS_OF(glGenBuffers));
+        addLibProcedure("glIsBufferARB", ADDRESS_OF(glIsBuffer));
+        addLibProcedure("glBufferDataARB", ADDRESS_OF(glBufferData));
+        addLibProcedure("glBufferSubDataARB", ADDRESS_OF(glBufferSubData));
+        addLibProcedure("glGetBufferSubDataARB", ADDRESS_OF(glGetBufferSubData));
+        addLibProcedure("glMapBufferARB", ADDRESS_OF(glMapBuffer));
+        addLibProcedure("glUnmapBufferARB", ADDRESS_OF(glUnmapBuffer));
+        addLibProcedure("glGetBufferParameterivARB", ADDRESS_OF(glGetBufferParameteriv));
+    }
     // addLibExtension("WGL_3DFX_gamma_control");
     // {
 
@@ -572,19 +623,61 @@ RIXGL::RIXGL(IBusConnector& busConnector, IThreadRunner& runner)
 
 RIXGL::~RIXGL()
 {
+#if RIX_CORE_HOSTED_THREADING
+    // The GL thread must be stopped before the pipeline is deleted
+    delete m_frontEnd;
+#endif
     delete m_renderDevice;
 }
 
 void RIXGL::swapDisplayList()
 {
     SPDLOG_INFO("swapDisplayList called");
-    m_renderDevice->pixelPipeline.swapDisplayList();
+#if RIX_CORE_HOSTED_THREADING
+    // An identical frame is not rendered again, the screen keeps showing the previous frame
+    m_frameReused = !m_frontEnd->commitFrame();
+    if (m_frameReused)
+    {
+        return;
+    }
+    m_frontEnd->executeSubmissions();
+    m_frontEnd->execute<swapDisplayListImpl>();
+    m_frontEnd->endFrame();
+#else
+    swapDisplayListImpl();
+#endif
 }
 
 void RIXGL::uploadDisplayList()
 {
     SPDLOG_INFO("uploadDisplayList called");
-    m_renderDevice->pixelPipeline.uploadDisplayList();
+#if RIX_CORE_HOSTED_THREADING
+    if (m_frameReused)
+    {
+        return;
+    }
+    m_frontEnd->execute<uploadDisplayListImpl>();
+    m_frontEnd->flush();
+#else
+    uploadDisplayListImpl();
+#endif
+}
+
+void RIXGL::swapDisplayListImpl()
+{
+    getInstance().m_renderDevice->pixelPipeline.swapDisplayList();
+}
+
+void RIXGL::uploadDisplayListImpl()
+{
+    getInstance().m_renderDevice->pixelPipeline.uploadDisplayList();
+}
+
+void RIXGL::snapshotStateImpl(StateSnapshot& snapshot)
+{
+    // The vertex array is not part of the snapshot. The recorded draws carry copies of the arrays.
+    getInstance().m_renderDevice->vertexPipeline.snapshotState(snapshot);
+    getInstance().m_renderDevice->vertexQueue.snapshotState(snapshot);
 }
 
 const char* RIXGL::getLibExtensions() const
@@ -636,6 +729,11 @@ VertexArray& RIXGL::vertexArray()
     return m_renderDevice->vertexArray;
 }
 
+BufferObjects& RIXGL::bufferObjects()
+{
+    return m_renderDevice->bufferObjects;
+}
+
 std::size_t RIXGL::getMaxTextureSize() const
 {
     return RenderConfig::MAX_TEXTURE_SIZE;
@@ -653,6 +751,7 @@ bool RIXGL::isMipmappingAvailable() const
 
 bool RIXGL::setRenderResolution(const std::size_t x, const std::size_t y)
 {
+    syncFrontEnd();
     return m_renderDevice->pixelPipeline.setRenderResolution(x, y);
 }
 
@@ -663,7 +762,115 @@ std::size_t RIXGL::getMaxLOD()
 
 void RIXGL::enableVSync(const bool enable)
 {
+    syncFrontEnd();
     m_renderDevice->pixelPipeline.enableVSync(enable);
 }
 
+bool RIXGL::setDisplayListAssemblyWorkers(tcb::span<IThreadRunner* const> workers)
+{
+    syncFrontEnd();
+    return m_renderDevice->pixelPipeline.setDisplayListAssemblyWorkers(workers);
+}
+
+std::size_t RIXGL::setMaxFramesInFlight(const std::size_t frames)
+{
+    syncFrontEnd();
+    return m_renderDevice->pixelPipeline.setMaxFramesInFlight(frames);
+}
+
+bool RIXGL::setDrawReordering(const bool enable)
+{
+    syncFrontEnd();
+    return m_renderDevice->pixelPipeline.setDrawReordering(enable);
+}
+
+std::size_t RIXGL::getAvoidedTextureStreams() const
+{
+    syncFrontEnd();
+    return m_renderDevice->pixelPipeline.getAvoidedTextureStreams();
+}
+
+VertexCacheStatistics RIXGL::getVertexCacheStatistics() const
+{
+    syncFrontEnd();
+    return m_renderDevice->vertexPipeline.getVertexCacheStatistics();
+}
+
+bool RIXGL::setRasterizerWorkers(tcb::span<IThreadRunner* const> workers)
+{
+    syncFrontEnd();
+    // The workers can only be changed while no display list is streamed
+    m_renderDevice->pixelPipeline.waitTillUploaded();
+    return m_renderDevice->device.setRasterizerWorkers(workers);
+}
+
+bool RIXGL::setRasterizerThread(IThreadRunner* runner)
+{
+    syncFrontEnd();
+    // The thread can only be changed while no display list is streamed
+    m_renderDevice->pixelPipeline.waitTillUploaded();
+    return m_renderDevice->device.setRasterizerThread(runner);
+}
+
+DisplayListQueueStatistics RIXGL::getRasterizerQueueStatistics() const
+{
+    return m_renderDevice->device.getRasterizerQueueStatistics();
+}
+
+bool RIXGL::setFrontEndThread(IThreadRunner* runner)
+{
+#if RIX_CORE_HOSTED_THREADING
+    // Stops a running thread after it has executed all recorded calls
+    m_frontEnd->setThread(runner);
+    return true;
+#else
+    return runner == nullptr;
+#endif
+}
+
+void RIXGL::setTaskPool(ITaskPool* pool)
+{
+    // The GL thread might currently use the pool
+    syncFrontEnd();
+    m_taskPool = pool;
+}
+
+bool RIXGL::setFrameReuse(const bool enable)
+{
+#if RIX_CORE_HOSTED_THREADING
+    m_frontEnd->setFrameReuse(enable, &snapshotStateImpl);
+    return true;
+#else
+    return !enable;
+#endif
+}
+
+std::size_t RIXGL::getReusedFrames() const
+{
+#if RIX_CORE_HOSTED_THREADING
+    return m_frontEnd->getReusedFrames();
+#else
+    return 0;
+#endif
+}
+
+#if RIX_CORE_HOSTED_THREADING
+void RIXGL::setRecordingContext(RecordingContext* context)
+{
+    RecordingContext::current() = context;
+}
+
+void RIXGL::submitRecordingContext(RecordingContext& context, const uint32_t order)
+{
+    m_frontEnd->submit(context, order);
+}
+#endif
+
+void RIXGL::syncFrontEnd() const
+{
+#if RIX_CORE_HOSTED_THREADING
+    m_frontEnd->sync();
+#endif
+}
+
 } // namespace rr
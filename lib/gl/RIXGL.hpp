@@ -19,7 +19,10 @@
 #define RIXGL_HPP
 
 #include "IBusConnector.hpp"
+#include "ITaskPool.hpp"
 #include "IThreadRunner.hpp"
+#include "renderer/threadedRasterizer/DisplayListQueueStatistics.hpp"
+#include "vertexpipeline/VertexCacheStatistics.hpp"
 #include <array>
 #include <functional>
 #include <map>
@@ -32,7 +35,11 @@ class RenderDevice;
 class VertexPipeline;
 class PixelPipeline;
 class VertexArray;
+class BufferObjects;
 class VertexQueue;
+class ThreadedFrontEnd;
+class RecordingContext;
+class StateSnapshot;
 class RIXGL
 {
 public:
@@ -60,6 +67,8 @@ public:
     VertexPipeline& pipeline();
     VertexQueue& vertexQueue();
     VertexArray& vertexArray();
+    BufferObjects& bufferObjects();
+    ThreadedFrontEnd& frontEnd() { return *m_frontEnd; } // Only available with RIX_CORE_HOSTED_THREADING
 
     void swapDisplayList();
     void uploadDisplayList();
@@ -96,10 +105,128 @@ public:
     /// @param enable true to enable vsync
     void enableVSync(const bool enable);
 
+    /// @brief Enables the parallel assembly of the display lists. Only has an effect when the
+    ///     screen is split into several display lists (rixif).
+    /// @param workers Runners which are used as workers to fill the display lists. The runners must
+    ///     execute the operation concurrently to the calling thread and must outlive this context.
+    ///     An empty span disables the parallel assembly.
+    /// @return true if succeeded
+    bool setDisplayListAssemblyWorkers(tcb::span<IThreadRunner* const> workers);
+
+    /// @brief Sets how many frames can be queued for the upload while the application records the next frame.
+    ///     More frames absorb jitter of the upload (for instance on slow links) but increase the latency.
+    ///     The default is one frame. Every further frame adds one frame of latency.
+    /// @param frames Number of queued frames. It is limited by the number of display lists the device provides.
+    /// @return The number of frames which is actually used
+    std::size_t setMaxFramesInFlight(const std::size_t frames);
+
+    /// @brief Enables the reordering of the draws within a frame. Opaque draws are sorted by their textures
+    ///     and states to reduce the texture streams. Blended draws keep their order.
+    /// @param enable true to enable the reordering
+    /// @return true if succeeded, false if the current configuration does not support it
+    bool setDrawReordering(const bool enable);
+
+    /// @brief Queries how many texture streams were avoided by the draw reordering
+    /// @return The number of avoided texture streams
+    std::size_t getAvoidedTextureStreams() const;
+
+    /// @brief Queries the counters of the post transform vertex cache. Indexed draw calls reuse the transformed
+    ///     vertices of repeated indices. The hit rate is hits / (hits + misses).
+    /// @return The counters
+    VertexCacheStatistics getVertexCacheStatistics() const;
+
+    /// @brief Enables the parallel transformation and rasterization of the vertices. Only has an effect
+    ///     when the threaded rasterization is enabled. The display lists are split at the draw calls into chunks
+    ///     which are processed by the workers and merged in the original order.
+    /// @param workers Runners which are used as workers. The runners must execute the operation concurrently
+    ///     to the calling thread and must outlive this context. An empty span disables the workers.
+    /// @return true if succeeded, false if the threaded rasterization is disabled or there are too many workers
+    bool setRasterizerWorkers(tcb::span<IThreadRunner* const> workers);
+
+    /// @brief Runs the threaded rasterization in an own thread. The display lists are handed over through a queue,
+    ///     therefore the upload of a display list does not have to wait till it is rasterized. Only has an effect
+    ///     when the threaded rasterization is enabled.
+    /// @param runner Runner which executes the rasterizer thread. The runner must execute the operation concurrently
+    ///     to the calling thread, is occupied till the thread is disabled, and must outlive this context.
+    ///     A nullptr disables the thread.
+    /// @return true if succeeded, false if the threaded rasterization is disabled
+    bool setRasterizerThread(IThreadRunner* runner);
+
+    /// @brief Queries the counters of the queue to the rasterizer thread. They show how long the threads waited
+    ///     for each other, the latency of the display lists in the queue and the load of the rasterizer thread.
+    /// @return The counters, all zero when the threaded rasterization is disabled
+    DisplayListQueueStatistics getRasterizerQueueStatistics() const;
+
+    /// @brief Runs the GL implementation (vertex transformation, lighting, clipping and display list assembly)
+    ///     in an own thread. The GL calls of the application are recorded into a queue and return immediately.
+    ///     The client arrays are copied at the draw calls. Calls which return data, like glGet*, wait till
+    ///     the thread has executed the recorded calls. swapDisplayList() lets the application record at most one
+    ///     frame ahead of the thread.
+    /// @param runner Runner which executes the GL thread. The runner must execute the operation concurrently
+    ///     to the calling thread, is occupied till the thread is disabled, and must outlive this context.
+    ///     A nullptr disables the thread.
+    /// @return true if succeeded, false if the lib is built without RIX_CORE_HOSTED_THREADING
+    bool setFrontEndThread(IThreadRunner* runner);
+
+    /// @brief Sets the pool which executes the fine-grained parallel work of the driver, like the conversion of
+    ///     large textures. The pool can be shared with the runners of the other threads (see ThreadPool), so all
+    ///     parallel work of the driver uses one scheduler.
+    /// @param pool The pool. It must outlive this context. A nullptr executes the work in the calling thread.
+    void setTaskPool(ITaskPool* pool);
+
+    /// @brief Queries the pool for the fine-grained parallel work
+    /// @return The pool or a nullptr if the work is executed in the calling thread
+    ITaskPool* getTaskPool() const { return m_taskPool; }
+
+    /// @brief Enables the reuse of static frames. The GL calls of the application thread are recorded till
+    ///     swapDisplayList() and compared with the calls of the previous frame. When they are identical, the frame
+    ///     would render the same image again. Then the calls are dropped and the screen keeps showing the previous
+    ///     frame, without running the vertex pipeline, the display list assembly and the upload. Otherwise the calls
+    ///     are executed at swapDisplayList(). The comparison covers the calls, their arguments and the copied client
+    ///     arrays. Additionally, the GL state at the start of the frame (like the matrices, the current vertex
+    ///     attributes and the enabled features) must be the same as at the start of the previous frame. Therefore
+    ///     a frame which changes the state relatively (like a glRotatef without glLoadIdentity) is always rendered.
+    ///     The state is checked after the previous frame was executed, so a reused frame waits for it. A frame
+    ///     which contains calls which can't be recorded (like glGet*, glTexImage2D or glFinish) or uses recording
+    ///     contexts is always rendered, as well as the frame after it.
+    /// @param enable true to enable the frame reuse
+    /// @return true if succeeded, false if the lib is built without RIX_CORE_HOSTED_THREADING
+    bool setFrameReuse(const bool enable);
+
+    /// @brief Queries how many frames were not rendered because they were identical to the previous frame
+    /// @return The number of reused frames
+    std::size_t getReusedFrames() const;
+
+    /// @brief Binds a recording context to the calling thread. The GL calls of the thread are then recorded into
+    ///     the context instead of being executed, therefore several threads can record the draws of a frame in
+    ///     parallel. Calls which return data or read application memory of an unknown size (like glGet* or
+    ///     glTexImage2D) can't be recorded and are ignored. The client arrays are copied at the draw calls.
+    ///     Only available with RIX_CORE_HOSTED_THREADING.
+    /// @param context The context which records the calls of this thread. It must outlive the binding.
+    ///     A nullptr lets the thread execute its calls directly again.
+    static void setRecordingContext(RecordingContext* context);
+
+    /// @brief Submits the calls recorded by a context. The submitted contexts are executed with the next
+    ///     swapDisplayList(), after the calls of the application thread, ordered by their order value. Contexts
+    ///     with the same order value are executed in the order of their submission. A context continues with the
+    ///     GL state the previous context has left and starts with the client arrays it has set while recording.
+    ///     The context can immediately record the next calls. Can be called from any thread, but not while
+    ///     the context records. Only available with RIX_CORE_HOSTED_THREADING.
+    /// @param context The context with the recorded calls
+    /// @param order Position of the context in the frame
+    void submitRecordingContext(RecordingContext& context, const uint32_t order);
+
 private:
     RIXGL(IBusConnector& busConnector, IThreadRunner& runner);
     ~RIXGL();
+    static void swapDisplayListImpl();
+    static void uploadDisplayListImpl();
+    static void snapshotStateImpl(StateSnapshot& snapshot);
+    void syncFrontEnd() const;
     RenderDevice* m_renderDevice { nullptr };
+    ThreadedFrontEnd* m_frontEnd { nullptr };
+    ITaskPool* m_taskPool { nullptr };
+    bool m_frameReused { false };
 
     // Errors
     uint32_t m_error { 0 };
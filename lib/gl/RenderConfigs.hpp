@@ -44,7 +44,22 @@ struct RenderConfig
     static constexpr bool THREADED_RASTERIZATION { RIX_CORE_THREADED_RASTERIZATION };
     static constexpr std::size_t THREADED_RASTERIZATION_BUFFER_COUNT { 20 };
     static constexpr std::size_t THREADED_RASTERIZATION_BUFFER_SIZE { 1024 * 1024 };
+    static constexpr std::size_t THREADED_RASTERIZATION_MAX_WORKERS { 8 };
+    static constexpr std::size_t THREADED_RASTERIZATION_MIN_CHUNK_SIZE { 16 * 1024 }; // Minimum size of the source display list a worker processes
+    static constexpr std::size_t THREADED_RASTERIZATION_VERTEX_BATCH_SIZE { 32 }; // Maximum number of vertices transferred with one command
+    static constexpr std::size_t THREADED_FRONT_END_QUEUE_SIZE { 1024 * 1024 }; // Size of the ring with the recorded GL calls
+    static constexpr std::size_t THREADED_FRONT_END_FLUSH_SIZE { 4 * 1024 }; // Recorded bytes after which the calls are handed over to the back end
+    static constexpr std::size_t VERTEX_CACHE_SIZE { 64 }; // Entries of the post transform vertex cache for indexed draws (power of two). 0 disables the cache
+    static constexpr std::size_t TEXTURE_CONVERSION_MIN_CHUNK_SIZE { 16 * 1024 }; // Minimum number of texels a task of the task pool converts
+    static constexpr std::size_t DEVICE_CLEAR_TO_SEND_TIMEOUT_MS { 1000 }; // Time after which a blocked upload is reported
     static constexpr bool ENABLE_VSYNC { RIX_CORE_ENABLE_VSYNC };
+    static constexpr std::size_t DISPLAY_LIST_ASSEMBLY_MAX_WORKERS { 8 };
+    static constexpr std::size_t DISPLAY_LIST_ASSEMBLY_QUEUE_SIZE { 256 * 1024 };
+    static constexpr std::size_t DISPLAY_LIST_OPTIMIZER_MAX_ELIMINATED_COMMANDS { 256 };
+    static constexpr std::size_t DISPLAY_LIST_RING_DEPTH { 3 }; // Number of display list sets, allows up to DEPTH - 1 frames in flight
+    static constexpr std::size_t DISPLAY_LIST_OVERFLOW_SEGMENTS { 8 }; // Segments per set which are chained to full display lists
+    static constexpr std::size_t DRAW_SORTER_MAX_DRAWS { 1024 }; // Recorded draws of the draw reordering before they are flushed
+    static constexpr std::size_t DRAW_SORTER_MAX_TRIANGLES { 4096 }; // Recorded triangles of the draw reordering before they are flushed
 
     static constexpr std::size_t getDisplayLines()
     {
@@ -0,0 +1,73 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef STATESNAPSHOT_HPP
+#define STATESNAPSHOT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace rr
+{
+
+// Byte copy of the GL state. Used by the frame reuse to check whether a frame starts with the same state as
+// the previous frame. Two snapshots are only comparable when they were taken with the same sequence of add() calls.
+class StateSnapshot
+{
+public:
+    template <typename T>
+    void add(const T& value)
+    {
+        add(&value, 1);
+    }
+
+    template <typename T>
+    void add(const T* values, const std::size_t count)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "The state must be copyable as bytes");
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(values);
+        m_data.insert(m_data.end(), bytes, bytes + (sizeof(T) * count));
+    }
+
+    // Adds a value which consists only of floats and provides them with data(), like the vectors and matrices
+    template <typename T>
+    void addFloats(const T& value)
+    {
+        static_assert((sizeof(T) % sizeof(float)) == 0, "The value must only contain floats");
+        add(value.data(), sizeof(T) / sizeof(float));
+    }
+
+    // Removes the content. Keeps the memory for the next snapshot.
+    void clear()
+    {
+        m_data.clear();
+    }
+
+    bool operator==(const StateSnapshot& rhs) const
+    {
+        return m_data == rhs.m_data;
+    }
+
+private:
+    std::vector<uint8_t> m_data {};
+};
+
+} // namespace rr
+
+#endif // STATESNAPSHOT_HPP
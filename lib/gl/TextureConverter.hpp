@@ -18,6 +18,8 @@
 #ifndef GL_TEXTURE_CONVERTER_HPP_
 #define GL_TEXTURE_CONVERTER_HPP_
 
+#include "ITaskPool.hpp"
+#include "RenderConfigs.hpp"
 #include "gl.h"
 #include "pixelpipeline/Texture.hpp"
 #include <algorithm>
@@ -42,55 +44,32 @@ public:
         const GLenum type,
         const uint8_t* pixels)
     {
-        std::size_t i = 0;
-        // TODO: Also use GL_UNPACK_ROW_LENGTH configured via glPixelStorei
-        for (std::size_t y = yoffset; y < static_cast<std::size_t>(height + yoffset); y++)
+        if ((width <= 0) || (height <= 0))
         {
-            for (std::size_t x = xoffset; x < static_cast<std::size_t>(width + xoffset); x++)
-            {
-                const std::size_t texPos { (y * originalTextureWidth) + x };
-                switch (format)
-                {
-                case GL_RGB:
-                    i += convertRgbTexel(
-                        texMemShared.get()[texPos],
-                        ipf,
-                        type,
-                        pixels + i);
-                    break;
-                case GL_RGBA:
-                    i += convertRgbaTexel(
-                        texMemShared.get()[texPos],
-                        ipf,
-                        type,
-                        pixels + i);
-                    break;
-                case GL_ALPHA:
-                case GL_RED:
-                case GL_GREEN:
-                case GL_BLUE:
-                case GL_BGR:
-                case GL_BGRA:
-                    i += convertBgraTexel(
-                        texMemShared.get()[texPos],
-                        ipf,
-                        type,
-                        pixels + i);
-                    break;
-                case GL_LUMINANCE:
-                case GL_LUMINANCE_ALPHA:
-                    SPDLOG_WARN("glTexSubImage2D unsupported format");
-                    return;
-                default:
-                    SPDLOG_WARN("glTexSubImage2D invalid format");
-                    RIXGL::getInstance().setError(GL_INVALID_ENUM);
-                    return;
-                }
-                if (RIXGL::getInstance().getError() != GL_NO_ERROR)
+            return;
+        }
+        // The first row is converted in the calling thread. It validates the format and the type and yields the size
+        // of a row in the source. The remaining rows can then be converted in parallel.
+        std::size_t rowSize = 0;
+        if (!convertRows(texMemShared.get(), ipf, originalTextureWidth, xoffset, yoffset, width, 1, format, type, pixels, rowSize))
+        {
+            return;
+        }
+        const std::size_t rows = static_cast<std::size_t>(height) - 1;
+        ITaskPool* pool = RIXGL::getInstance().getTaskPool();
+        if (pool)
+        {
+            const std::size_t grain = (std::max)(RenderConfig::TEXTURE_CONVERSION_MIN_CHUNK_SIZE / static_cast<std::size_t>(width), static_cast<std::size_t>(1));
+            pool->parallelFor(rows, grain, [&](const std::size_t begin, const std::size_t end)
                 {
-                    return;
-                }
-            }
+                    std::size_t consumed = 0;
+                    convertRows(texMemShared.get(), ipf, originalTextureWidth, xoffset, yoffset + 1 + begin, width, end - begin, format, type, pixels + ((1 + begin) * rowSize), consumed);
+                });
+        }
+        else
+        {
+            std::size_t consumed = 0;
+            convertRows(texMemShared.get(), ipf, originalTextureWidth, xoffset, yoffset + 1, width, rows, format, type, pixels + rowSize, consumed);
         }
     }
 
@@ -163,6 +142,72 @@ public:
     }
 
 private:
+    // Converts the rows and returns false if the format or type is invalid. consumed is increased by the read bytes of the source.
+    static bool convertRows(
+        uint16_t* texMem,
+        const TextureObject::IntendedInternalPixelFormat ipf,
+        const std::size_t originalTextureWidth,
+        const GLint xoffset,
+        const std::size_t yoffset,
+        const GLsizei width,
+        const std::size_t height,
+        const GLenum format,
+        const GLenum type,
+        const uint8_t* pixels,
+        std::size_t& consumed)
+    {
+        // TODO: Also use GL_UNPACK_ROW_LENGTH configured via glPixelStorei
+        for (std::size_t y = yoffset; y < (height + yoffset); y++)
+        {
+            for (std::size_t x = xoffset; x < static_cast<std::size_t>(width + xoffset); x++)
+            {
+                const std::size_t texPos { (y * originalTextureWidth) + x };
+                switch (format)
+                {
+                case GL_RGB:
+                    consumed += convertRgbTexel(
+                        texMem[texPos],
+                        ipf,
+                        type,
+                        pixels + consumed);
+                    break;
+                case GL_RGBA:
+                    consumed += convertRgbaTexel(
+                        texMem[texPos],
+                        ipf,
+                        type,
+                        pixels + consumed);
+                    break;
+                case GL_ALPHA:
+                case GL_RED:
+                case GL_GREEN:
+                case GL_BLUE:
+                case GL_BGR:
+                case GL_BGRA:
+                    consumed += convertBgraTexel(
+                        texMem[texPos],
+                        ipf,
+                        type,
+                        pixels + consumed);
+                    break;
+                case GL_LUMINANCE:
+                case GL_LUMINANCE_ALPHA:
+                    SPDLOG_WARN("glTexSubImage2D unsupported format");
+                    return false;
+                default:
+                    SPDLOG_WARN("glTexSubImage2D invalid format");
+                    RIXGL::getInstance().setError(GL_INVALID_ENUM);
+                    return false;
+                }
+                if (RIXGL::getInstance().getError() != GL_NO_ERROR)
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
     template <uint8_t ColorPos, uint8_t ComponentSize, uint8_t Mask>
     static uint8_t convertColorComponentToUint8(const uint16_t color)
     {
@@ -0,0 +1,81 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef WAITCONDITION_HPP
+#define WAITCONDITION_HPP
+
+#if RIX_CORE_HOSTED_THREADING
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#endif
+
+namespace rr
+{
+
+// Lets a thread wait till a predicate over atomics becomes true, which is changed by another thread. The other
+// thread calls notify() after every change. Hosted builds (RIX_CORE_HOSTED_THREADING) let the waiting thread
+// sleep on a condition variable. Otherwise the predicate is polled, which requires no threading primitives
+// of the platform.
+class WaitCondition
+{
+public:
+    template <typename Pred>
+    void wait(const Pred& pred)
+    {
+#if RIX_CORE_HOSTED_THREADING
+        if (pred())
+        {
+            return;
+        }
+        // The waiter announces itself before it checks the predicate under the lock. The notifier changes the
+        // atomics before it checks for waiters. Both are sequentially consistent, therefore either the waiter
+        // sees the change or the notifier sees the waiter and wakes it up.
+        std::unique_lock<std::mutex> lock { m_mutex };
+        m_waiters.fetch_add(1);
+        m_condition.wait(lock, pred);
+        m_waiters.fetch_sub(1);
+#else
+        while (!pred())
+        {
+        }
+#endif
+    }
+
+    void notify()
+    {
+#if RIX_CORE_HOSTED_THREADING
+        if (m_waiters.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock { m_mutex };
+            m_condition.notify_all();
+        }
+#endif
+    }
+
+private:
+#if RIX_CORE_HOSTED_THREADING
+    std::mutex m_mutex {};
+    std::condition_variable m_condition {};
+    std::atomic<std::size_t> m_waiters { 0 };
+#endif
+};
+
+} // namespace rr
+
+#endif // WAITCONDITION_HPP
@@ -0,0 +1,384 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "ClientArrays.hpp"
+#include "glImpl.h"
+#include <algorithm>
+#include <cstring>
+
+namespace rr::frontend
+{
+
+namespace
+{
+constexpr std::size_t DATA_ALIGNMENT { 8 };
+
+std::size_t alignData(const std::size_t size)
+{
+    return (size + DATA_ALIGNMENT - 1) & ~(DATA_ALIGNMENT - 1);
+}
+
+std::size_t getTypeSize(const GLenum type)
+{
+    switch (type)
+    {
+    case GL_BYTE:
+    case GL_UNSIGNED_BYTE:
+        return 1;
+    case GL_SHORT:
+    case GL_UNSIGNED_SHORT:
+        return 2;
+    case GL_INT:
+    case GL_UNSIGNED_INT:
+    case GL_FLOAT:
+        return 4;
+    case GL_DOUBLE:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+template <typename T>
+void getIndexRange(const GLvoid* indices, const GLsizei count, uint32_t& min, uint32_t& max)
+{
+    const T* idx = static_cast<const T*>(indices);
+    min = idx[0];
+    max = idx[0];
+    for (GLsizei i = 1; i < count; i++)
+    {
+        min = (std::min)(min, static_cast<uint32_t>(idx[i]));
+        max = (std::max)(max, static_cast<uint32_t>(idx[i]));
+    }
+}
+
+template <typename T>
+void rebaseIndices(const GLvoid* indices, const GLsizei count, const uint32_t base, uint8_t* dst)
+{
+    const T* src = static_cast<const T*>(indices);
+    T* out = reinterpret_cast<T*>(dst);
+    for (GLsizei i = 0; i < count; i++)
+    {
+        out[i] = static_cast<T>(src[i] - base);
+    }
+}
+} // namespace
+
+void ClientArrays::vertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    m_arrays[VERTEX].set(size, type, stride, pointer, m_arrayBuffer);
+}
+
+void ClientArrays::colorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    m_arrays[COLOR].set(size, type, stride, pointer, m_arrayBuffer);
+}
+
+void ClientArrays::normalPointer(GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    m_arrays[NORMAL].set(3, type, stride, pointer, m_arrayBuffer);
+}
+
+void ClientArrays::texCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+{
+    const std::size_t tmu = m_clientActiveTexture - GL_TEXTURE0;
+    if (tmu < RenderConfig::TMU_COUNT)
+    {
+        m_arrays[TEX_COORD + tmu].set(size, type, stride, pointer, m_arrayBuffer);
+    }
+}
+
+void ClientArrays::clientActiveTexture(GLenum texture)
+{
+    m_clientActiveTexture = texture;
+}
+
+void ClientArrays::setClientState(GLenum cap, bool enable)
+{
+    const std::size_t tmu = m_clientActiveTexture - GL_TEXTURE0;
+    switch (cap)
+    {
+    case GL_VERTEX_ARRAY:
+        m_arrays[VERTEX].enabled = enable;
+        break;
+    case GL_COLOR_ARRAY:
+        m_arrays[COLOR].enabled = enable;
+        break;
+    case GL_NORMAL_ARRAY:
+        m_arrays[NORMAL].enabled = enable;
+        break;
+    case GL_TEXTURE_COORD_ARRAY:
+        if (tmu < RenderConfig::TMU_COUNT)
+        {
+            m_arrays[TEX_COORD + tmu].enabled = enable;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void ClientArrays::bindBuffer(GLenum target, GLuint buffer)
+{
+    if (target == GL_ARRAY_BUFFER)
+    {
+        m_arrayBuffer = buffer;
+    }
+    else if (target == GL_ELEMENT_ARRAY_BUFFER)
+    {
+        m_elementArrayBuffer = buffer;
+    }
+}
+
+void ClientArrays::deleteBuffer(GLuint buffer)
+{
+    // Same as the back end: The deleted buffer is detached from the bindings and the arrays
+    if (buffer == 0)
+    {
+        return;
+    }
+    if (m_arrayBuffer == buffer)
+    {
+        m_arrayBuffer = 0;
+    }
+    if (m_elementArrayBuffer == buffer)
+    {
+        m_elementArrayBuffer = 0;
+    }
+    for (ClientArray& array : m_arrays)
+    {
+        if (array.buffer == buffer)
+        {
+            array.buffer = 0;
+            array.pointer = nullptr;
+        }
+    }
+}
+
+void ClientArrays::apply() const
+{
+    const auto setState = [](const GLenum cap, const bool enable)
+    {
+        if (enable)
+        {
+            impl_glEnableClientState(cap);
+        }
+        else
+        {
+            impl_glDisableClientState(cap);
+        }
+    };
+    setState(GL_VERTEX_ARRAY, m_arrays[VERTEX].enabled);
+    setState(GL_COLOR_ARRAY, m_arrays[COLOR].enabled);
+    setState(GL_NORMAL_ARRAY, m_arrays[NORMAL].enabled);
+    for (std::size_t i = TEX_COORD; i < ARRAY_COUNT; i++)
+    {
+        impl_glClientActiveTexture(GL_TEXTURE0 + (i - TEX_COORD));
+        setState(GL_TEXTURE_COORD_ARRAY, m_arrays[i].enabled);
+    }
+    impl_glClientActiveTexture(m_clientActiveTexture);
+    setPointers(nullptr, {});
+    impl_glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_elementArrayBuffer);
+}
+
+void ClientArrays::execute(void* call)
+{
+    static_cast<ClientArrays*>(call)->apply();
+}
+
+void ClientArrays::setPointers(const uint8_t* data, const std::array<uint32_t, ARRAY_COUNT>& offsets) const
+{
+    const auto pointer = [&](const std::size_t i)
+    {
+        return (data && (m_arrays[i].buffer == 0)) ? static_cast<const GLvoid*>(data + offsets[i]) : m_arrays[i].pointer;
+    };
+    // The pointers are interpreted relative to the bound array buffer. Bind the buffer of each array while its
+    // pointer is set and restore the binding afterwards. Without buffers, the bindings are left untouched.
+    const bool buffered = (m_arrayBuffer != 0) || std::any_of(m_arrays.begin(), m_arrays.end(), [](const ClientArray& array)
+                                                       { return array.buffer != 0; });
+    const auto bind = [&](const std::size_t i)
+    {
+        if (buffered)
+        {
+            impl_glBindBuffer(GL_ARRAY_BUFFER, m_arrays[i].buffer);
+        }
+    };
+    // Without data, all pointers are set, because the state of the disabled arrays is restored as well
+    if (m_arrays[VERTEX].enabled || !data)
+    {
+        bind(VERTEX);
+        impl_glVertexPointer(m_arrays[VERTEX].size, m_arrays[VERTEX].type, m_arrays[VERTEX].stride, pointer(VERTEX));
+    }
+    if (m_arrays[COLOR].enabled || !data)
+    {
+        bind(COLOR);
+        impl_glColorPointer(m_arrays[COLOR].size, m_arrays[COLOR].type, m_arrays[COLOR].stride, pointer(COLOR));
+    }
+    if (m_arrays[NORMAL].enabled || !data)
+    {
+        bind(NORMAL);
+        impl_glNormalPointer(m_arrays[NORMAL].type, m_arrays[NORMAL].stride, pointer(NORMAL));
+    }
+    bool texCoordsChanged { false };
+    for (std::size_t i = TEX_COORD; i < ARRAY_COUNT; i++)
+    {
+        if (m_arrays[i].enabled || !data)
+        {
+            impl_glClientActiveTexture(GL_TEXTURE0 + (i - TEX_COORD));
+            bind(i);
+            impl_glTexCoordPointer(m_arrays[i].size, m_arrays[i].type, m_arrays[i].stride, pointer(i));
+            texCoordsChanged = true;
+        }
+    }
+    if (texCoordsChanged)
+    {
+        impl_glClientActiveTexture(m_clientActiveTexture);
+    }
+    if (buffered)
+    {
+        impl_glBindBuffer(GL_ARRAY_BUFFER, m_arrayBuffer);
+    }
+}
+
+void ClientArrays::DrawCall::execute(void* call)
+{
+    DrawCall& draw = *static_cast<DrawCall*>(call);
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(&draw + 1);
+    draw.arrays.setPointers(data, draw.offsets);
+    if (draw.type == GL_NONE)
+    {
+        impl_glDrawArrays(draw.mode, draw.first, draw.count);
+    }
+    else if (draw.arrays.hasElementArrayBuffer())
+    {
+        impl_glDrawElements(draw.mode, draw.count, draw.type, draw.indices);
+    }
+    else
+    {
+        impl_glDrawElements(draw.mode, draw.count, draw.type, data + draw.indicesOffset);
+    }
+    draw.arrays.setPointers(nullptr, draw.offsets);
+}
+
+std::size_t ClientArrays::DrawCall::prepare(const GLint first, const GLvoid* indices)
+{
+    const bool elementArrayBuffer = (type != GL_NONE) && arrays.hasElementArrayBuffer();
+    bool clientArrays { false };
+    bool bufferArrays { false };
+    for (const ClientArray& array : arrays.m_arrays)
+    {
+        clientArrays |= array.enabled && (array.buffer == 0);
+        bufferArrays |= array.enabled && (array.buffer != 0);
+    }
+    if (elementArrayBuffer || bufferArrays)
+    {
+        // The indices in a buffer and the range of a buffer can't be read by the front end, therefore the client
+        // arrays can't be copied together with buffers. Without client arrays, the draw is recorded as it is.
+        if (clientArrays)
+        {
+            return INVALID_SIZE;
+        }
+        this->first = first;
+        this->indices = elementArrayBuffer ? indices : nullptr;
+        if ((type != GL_NONE) && !elementArrayBuffer)
+        {
+            // Client indices are copied as they are
+            indicesOffset = 0;
+            return count * getTypeSize(type);
+        }
+        return 0;
+    }
+
+    // Range of the vertices which are read by the draw
+    uint32_t min = first;
+    uint32_t max = first + count - 1;
+    switch (type)
+    {
+    case GL_UNSIGNED_BYTE:
+        getIndexRange<uint8_t>(indices, count, min, max);
+        break;
+    case GL_UNSIGNED_SHORT:
+        getIndexRange<uint16_t>(indices, count, min, max);
+        break;
+    case GL_UNSIGNED_INT:
+        getIndexRange<uint32_t>(indices, count, min, max);
+        break;
+    default:
+        break;
+    }
+    base = min;
+    vertexCount = max - min + 1;
+
+    std::size_t dataSize = 0;
+    for (std::size_t i = 0; i < ARRAY_COUNT; i++)
+    {
+        const ClientArray& array = arrays.m_arrays[i];
+        if (!array.enabled)
+        {
+            continue;
+        }
+        const std::size_t elementSize = array.size * getTypeSize(array.type);
+        const std::size_t stride = array.stride ? array.stride : elementSize;
+        if ((elementSize == 0) || (array.pointer == nullptr) || (array.stride < 0))
+        {
+            return INVALID_SIZE;
+        }
+        offsets[i] = dataSize;
+        dataSize = alignData(dataSize + ((vertexCount - 1) * stride) + elementSize);
+    }
+    indicesOffset = dataSize;
+    if (type != GL_NONE)
+    {
+        dataSize += count * getTypeSize(type);
+    }
+    return dataSize;
+}
+
+void ClientArrays::DrawCall::copy(const GLvoid* indices)
+{
+    uint8_t* data = reinterpret_cast<uint8_t*>(this + 1);
+    if ((type != GL_NONE) && arrays.hasElementArrayBuffer())
+    {
+        return;
+    }
+    for (std::size_t i = 0; i < ARRAY_COUNT; i++)
+    {
+        const ClientArray& array = arrays.m_arrays[i];
+        if (array.enabled && (array.buffer == 0))
+        {
+            const std::size_t elementSize = array.size * getTypeSize(array.type);
+            const std::size_t stride = array.stride ? array.stride : elementSize;
+            std::memcpy(data + offsets[i], static_cast<const uint8_t*>(array.pointer) + (base * stride), ((vertexCount - 1) * stride) + elementSize);
+        }
+    }
+    switch (type)
+    {
+    case GL_UNSIGNED_BYTE:
+        rebaseIndices<uint8_t>(indices, count, base, data + indicesOffset);
+        break;
+    case GL_UNSIGNED_SHORT:
+        rebaseIndices<uint16_t>(indices, count, base, data + indicesOffset);
+        break;
+    case GL_UNSIGNED_INT:
+        rebaseIndices<uint32_t>(indices, count, base, data + indicesOffset);
+        break;
+    default:
+        break;
+    }
+}
+
+} // namespace rr::frontend
@@ -0,0 +1,155 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _CLIENT_ARRAYS_HPP_
+#define _CLIENT_ARRAYS_HPP_
+
+#include "RenderConfigs.hpp"
+#include "gl.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+namespace rr::frontend
+{
+
+// Client array state of a recorder. It is tracked while recording to copy the arrays at the draw calls,
+// because the application can change the arrays right after the draw.
+class ClientArrays
+{
+public:
+    void vertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+    void colorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+    void normalPointer(GLenum type, GLsizei stride, const GLvoid* pointer);
+    void texCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer);
+    void clientActiveTexture(GLenum texture);
+    void setClientState(GLenum cap, bool enable);
+    void bindBuffer(GLenum target, GLuint buffer);
+    void deleteBuffer(GLuint buffer);
+
+    bool hasElementArrayBuffer() const { return m_elementArrayBuffer != 0; }
+
+    // Records a draw together with the copies of the enabled arrays. For glDrawArrays the type is GL_NONE.
+    // Returns false when the arrays can't be copied or are too big for the storage. Nothing is recorded then.
+    template <typename Storage>
+    bool recordDraw(Storage& storage, GLenum mode, GLsizei count, GLint first, GLenum type, const GLvoid* indices) const;
+
+    // Records a call which sets the whole client array state in the back end to this state
+    template <typename Storage>
+    void recordState(Storage& storage) const
+    {
+        new (storage.allocate(sizeof(ClientArrays), &ClientArrays::execute)) ClientArrays { *this };
+        storage.commit();
+    }
+
+    // Sets the whole client array state in the back end to this state
+    void apply() const;
+
+private:
+    static constexpr std::size_t INVALID_SIZE { ~std::size_t { 0 } };
+    static constexpr std::size_t ARRAY_COUNT { 3 + RenderConfig::TMU_COUNT };
+    static constexpr std::size_t VERTEX { 0 };
+    static constexpr std::size_t COLOR { 1 };
+    static constexpr std::size_t NORMAL { 2 };
+    static constexpr std::size_t TEX_COORD { 3 };
+
+    struct ClientArray
+    {
+        bool enabled { false };
+        GLint size { 4 };
+        GLenum type { GL_FLOAT };
+        GLsizei stride { 0 };
+        const GLvoid* pointer { nullptr };
+        // Buffer object of the array. The pointer is then an offset into the buffer, which is not copied.
+        GLuint buffer { 0 };
+
+        // Only writes the members. The padding keeps its value, which keeps the records comparable.
+        void set(GLint newSize, GLenum newType, GLsizei newStride, const GLvoid* newPointer, GLuint newBuffer)
+        {
+            size = newSize;
+            type = newType;
+            stride = newStride;
+            pointer = newPointer;
+            buffer = newBuffer;
+        }
+    };
+
+    struct DrawCall;
+
+    static void execute(void* call);
+
+    // Sets the pointers to the copies in data or, with a nullptr, to the recorded pointers
+    void setPointers(const uint8_t* data, const std::array<uint32_t, ARRAY_COUNT>& offsets) const;
+
+    std::array<ClientArray, ARRAY_COUNT> m_arrays { ClientArray {}, ClientArray {}, ClientArray { false, 3, GL_FLOAT, 0, nullptr } };
+    GLenum m_clientActiveTexture { GL_TEXTURE0 };
+    GLuint m_arrayBuffer { 0 };
+    GLuint m_elementArrayBuffer { 0 };
+};
+
+// A draw call with the copied client arrays. The arrays and the indices are stored behind the record.
+// The back end points the client arrays to the copies for the draw and restores the recorded pointers
+// afterwards, therefore later calls see the same state as without the recording. Arrays and indices in buffer
+// objects are already stored in the back end and are used as they are.
+struct ClientArrays::DrawCall
+{
+    GLenum mode;
+    GLsizei count;
+    GLenum type;
+    GLint first;
+    const GLvoid* indices;
+    ClientArrays arrays;
+    uint32_t base { 0 };
+    uint32_t vertexCount { 0 };
+    uint32_t indicesOffset { 0 };
+    std::array<uint32_t, ARRAY_COUNT> offsets {};
+
+    static void execute(void* call);
+
+    // Computes the range of the vertices and the layout of the data. Returns the size of the data.
+    std::size_t prepare(GLint first, const GLvoid* indices);
+
+    // Copies the arrays and the indices behind the record
+    void copy(const GLvoid* indices);
+};
+
+template <typename Storage>
+bool ClientArrays::recordDraw(Storage& storage, GLenum mode, GLsizei count, GLint first, GLenum type, const GLvoid* indices) const
+{
+    // The padding of the record is cleared, because the frame reuse compares the records
+    DrawCall draw;
+    std::memset(static_cast<void*>(&draw), 0, sizeof(draw));
+    draw.mode = mode;
+    draw.count = count;
+    draw.type = type;
+    draw.arrays = *this;
+    const std::size_t dataSize = draw.prepare(first, indices);
+    if ((dataSize == INVALID_SIZE) || ((sizeof(DrawCall) + dataSize) > storage.getMaxPayloadSize()))
+    {
+        return false;
+    }
+    DrawCall* record = new (storage.allocate(sizeof(DrawCall) + dataSize, &DrawCall::execute)) DrawCall { draw };
+    record->copy(indices);
+    storage.commit();
+    return true;
+}
+
+} // namespace rr::frontend
+
+#endif // _CLIENT_ARRAYS_HPP_
@@ -0,0 +1,140 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _COMMAND_BUFFER_HPP_
+#define _COMMAND_BUFFER_HPP_
+
+#include "frontend/CommandRing.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <vector>
+
+namespace rr
+{
+
+// Linear buffer of records in the same format as the CommandRing. It grows with the recorded calls and is
+// executed as a whole. Used by one thread at a time, therefore it does not synchronize.
+class CommandBuffer
+{
+public:
+    using Execute = CommandRing::Execute;
+    using Header = CommandRing::Header;
+    using Block = CommandRing::Block;
+
+    // The size of a record is stored in 32 bits
+    std::size_t getMaxPayloadSize() const
+    {
+        return (std::numeric_limits<uint32_t>::max)() / 2;
+    }
+
+    // Reserves a record and returns the memory for the payload. The record is part of the buffer after commit().
+    void* allocate(const std::size_t payloadSize, const Execute execute)
+    {
+        const std::size_t size = CommandRing::align(sizeof(Header) + payloadSize);
+        const std::size_t blocks = (m_head + size) / CommandRing::ALIGNMENT;
+        if (blocks > m_buffer.size())
+        {
+            m_buffer.resize((std::max)(blocks, m_buffer.size() * 2));
+        }
+        // Cleared, so that the padding of the records does not depend on the previous content of the buffer
+        std::memset(&m_buffer[m_head / CommandRing::ALIGNMENT], 0, size);
+        Header* header = new (&m_buffer[m_head / CommandRing::ALIGNMENT]) Header { execute, static_cast<uint32_t>(size) };
+        m_pending = size;
+        return header + 1;
+    }
+
+    // Finishes the record returned by allocate()
+    void commit()
+    {
+        m_head += m_pending;
+    }
+
+    // Executes all records in the order of their recording
+    void execute()
+    {
+        for (std::size_t pos = 0; pos < m_head;)
+        {
+            Header* header = reinterpret_cast<Header*>(&m_buffer[pos / CommandRing::ALIGNMENT]);
+            header->execute(header + 1);
+            pos += header->size;
+        }
+    }
+
+    // Removes all records. Keeps the memory for the next recording.
+    void clear()
+    {
+        m_head = 0;
+    }
+
+    bool empty() const
+    {
+        return m_head == 0;
+    }
+
+    // Hash over the records. Buffers with the same calls and arguments have the same hash. Different buffers can
+    // also have the same hash, therefore an equal hash must be confirmed with equals().
+    uint64_t hash() const
+    {
+        constexpr uint64_t PRIME_1 { 0x9E3779B185EBCA87ull };
+        constexpr uint64_t PRIME_2 { 0xC2B2AE3D27D4EB4Full };
+        uint64_t hash = m_head * PRIME_1;
+        for (std::size_t i = 0; i < (m_head / CommandRing::ALIGNMENT); i++)
+        {
+            uint64_t words[CommandRing::ALIGNMENT / sizeof(uint64_t)];
+            std::memcpy(words, m_buffer[i].data, sizeof(words));
+            for (const uint64_t word : words)
+            {
+                hash += word * PRIME_2;
+                hash = (hash << 31) | (hash >> 33);
+                hash *= PRIME_1;
+            }
+        }
+        return hash;
+    }
+
+    // Compares the records byte by byte
+    bool equals(const CommandBuffer& other) const
+    {
+        return (m_head == other.m_head) && ((m_head == 0) || (std::memcmp(m_buffer.data(), other.m_buffer.data(), m_head) == 0));
+    }
+
+    // Replaces the records with a copy of the records of another buffer. Keeps the memory for the next copy.
+    void copy(const CommandBuffer& other)
+    {
+        const std::size_t blocks = other.m_head / CommandRing::ALIGNMENT;
+        if (blocks > m_buffer.size())
+        {
+            m_buffer.resize(blocks);
+        }
+        std::copy(other.m_buffer.begin(), other.m_buffer.begin() + blocks, m_buffer.begin());
+        m_head = other.m_head;
+        m_pending = 0;
+    }
+
+private:
+    std::vector<Block> m_buffer {};
+    std::size_t m_head { 0 };
+    std::size_t m_pending { 0 };
+};
+
+} // namespace rr
+
+#endif // _COMMAND_BUFFER_HPP_
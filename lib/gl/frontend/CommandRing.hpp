@@ -0,0 +1,206 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _COMMAND_RING_HPP_
+#define _COMMAND_RING_HPP_
+
+#include "WaitCondition.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace rr
+{
+
+// Single producer, single consumer ring of variable sized records. A record consists of a function and its
+// arguments, which are stored directly behind the header. The producer writes the records without taking a
+// lock and publishes them in batches, the consumer executes them in order. A record is never split at the end
+// of the ring, the rest of the ring is skipped instead.
+class CommandRing
+{
+public:
+    using Execute = void (*)(void* payload);
+
+    static constexpr std::size_t ALIGNMENT { 16 };
+
+    // Allocates the ring and enables it. Must only be called when no consumer is running.
+    void open(const std::size_t size, const std::size_t flushSize)
+    {
+        m_buffer.resize(size / ALIGNMENT);
+        m_size = m_buffer.size() * ALIGNMENT;
+        m_flushSize = flushSize;
+        m_head = 0;
+        m_published.store(0);
+        m_consumed.store(0);
+        m_closed.store(false);
+    }
+
+    // Publishes the pending records and disables the ring. execute() returns when all records are executed.
+    void close()
+    {
+        flush();
+        m_closed.store(true);
+        m_waitCondition.notify();
+    }
+
+    // Frees the memory of the ring. Must only be called when the consumer has returned.
+    void release()
+    {
+        m_buffer.clear();
+        m_buffer.shrink_to_fit();
+        m_size = 0;
+    }
+
+    // The largest payload a record can carry. Bigger records would block the ring for too long.
+    std::size_t getMaxPayloadSize() const
+    {
+        return (m_size / 4) - sizeof(Header);
+    }
+
+    // Producer: Reserves a record and returns the memory for the payload. The record is visible to the consumer
+    // after commit() and the next flush. Waits while the ring is full.
+    void* allocate(const std::size_t payloadSize, const Execute execute)
+    {
+        const std::size_t size = align(sizeof(Header) + payloadSize);
+        const std::size_t pos = m_head % m_size;
+        if ((pos + size) > m_size)
+        {
+            reserve(m_size - pos);
+            new (&m_buffer[pos / ALIGNMENT]) Header { nullptr, static_cast<uint32_t>(m_size - pos) };
+            m_head += m_size - pos;
+        }
+        reserve(size);
+        Header* header = new (&m_buffer[(m_head % m_size) / ALIGNMENT]) Header { execute, static_cast<uint32_t>(size) };
+        m_pending = size;
+        return header + 1;
+    }
+
+    // Producer: Finishes the record returned by allocate(). Publishes the records when a batch is complete.
+    void commit()
+    {
+        m_head += m_pending;
+        if ((m_head - m_published.load(std::memory_order_relaxed)) >= m_flushSize)
+        {
+            flush();
+        }
+    }
+
+    // Producer: Makes all committed records visible to the consumer
+    void flush()
+    {
+        if (m_published.load(std::memory_order_relaxed) != m_head)
+        {
+            m_published.store(m_head);
+            m_waitCondition.notify();
+        }
+    }
+
+    // Producer: Position behind the last committed record
+    std::size_t getPosition() const
+    {
+        return m_head;
+    }
+
+    // Producer: Waits till the consumer has executed all records before the position
+    void waitTillExecuted(const std::size_t position)
+    {
+        flush();
+        m_waitCondition.wait([&]()
+            { return m_consumed.load() >= position; });
+    }
+
+    // Producer: Waits till the consumer has executed all records
+    void waitTillIdle()
+    {
+        waitTillExecuted(m_head);
+    }
+
+    // Consumer: Executes the records till the ring is closed
+    bool execute()
+    {
+        std::size_t consumed = m_consumed.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            m_waitCondition.wait([&]()
+                { return (m_published.load() != consumed) || m_closed.load(); });
+            const std::size_t published = m_published.load();
+            if (published == consumed)
+            {
+                return true;
+            }
+            while (consumed != published)
+            {
+                Header* header = reinterpret_cast<Header*>(&m_buffer[(consumed % m_size) / ALIGNMENT]);
+                if (header->execute)
+                {
+                    header->execute(header + 1);
+                }
+                consumed += header->size;
+                m_consumed.store(consumed);
+                m_waitCondition.notify();
+            }
+        }
+    }
+
+    // Layout of a record. Also used by the CommandBuffer.
+    struct alignas(ALIGNMENT) Header
+    {
+        Execute execute;
+        uint32_t size;
+    };
+
+    struct alignas(ALIGNMENT) Block
+    {
+        uint8_t data[ALIGNMENT];
+    };
+
+    static constexpr std::size_t align(const std::size_t size)
+    {
+        return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+    }
+
+private:
+    void reserve(const std::size_t size)
+    {
+        if ((m_size - (m_head - m_consumed.load(std::memory_order_acquire))) >= size)
+        {
+            return;
+        }
+        flush();
+        m_waitCondition.wait([&]()
+            { return (m_size - (m_head - m_consumed.load())) >= size; });
+    }
+
+    std::vector<Block> m_buffer {};
+    std::size_t m_size { 0 };
+    std::size_t m_flushSize { 0 };
+
+    // Monotonic byte counters. The position in the ring is the counter modulo the size.
+    std::size_t m_head { 0 }; // Producer only
+    std::size_t m_pending { 0 }; // Producer only
+    std::atomic<std::size_t> m_published { 0 };
+    std::atomic<std::size_t> m_consumed { 0 };
+    std::atomic<bool> m_closed { true };
+
+    WaitCondition m_waitCondition {};
+};
+
+} // namespace rr
+
+#endif // _COMMAND_RING_HPP_
@@ -0,0 +1,52 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "RecordingContext.hpp"
+#include "glImpl.h"
+#include <utility>
+
+namespace rr
+{
+
+RecordingContext::RecordingContext()
+{
+    m_arrays.recordState(m_buffer);
+}
+
+RecordingContext::~RecordingContext()
+{
+    if (current() == this)
+    {
+        current() = nullptr;
+    }
+}
+
+void RecordingContext::draw(GLenum mode, GLsizei count, GLint first, GLenum type, const GLvoid* indices)
+{
+    if (!m_arrays.recordDraw(m_buffer, mode, count, first, type, indices))
+    {
+        SPDLOG_ERROR("The client arrays of a draw call can't be recorded. The draw is ignored.");
+    }
+}
+
+void RecordingContext::exchange(CommandBuffer& buffer)
+{
+    std::swap(m_buffer, buffer);
+    m_arrays.recordState(m_buffer);
+}
+
+} // namespace rr
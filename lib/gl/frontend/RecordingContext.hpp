@@ -0,0 +1,84 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _RECORDING_CONTEXT_HPP_
+#define _RECORDING_CONTEXT_HPP_
+
+#include "frontend/ClientArrays.hpp"
+#include "frontend/CommandBuffer.hpp"
+#include "frontend/ThreadedFrontEnd.hpp"
+#include "gl.h"
+#include <spdlog/spdlog.h>
+#include <type_traits>
+
+namespace rr
+{
+
+// Records the GL calls of a thread into an own command buffer. A thread which has a current recording context
+// does not execute its calls, they are executed when the context is submitted (see RIXGL::submitRecordingContext()).
+// Therefore several threads can record a frame in parallel. The same calls as in the ThreadedFrontEnd are recordable.
+// All other calls (calls which return data or read application memory of an unknown size) are rejected, because
+// they would need the state of the GL, which is only valid after the execution of the previous calls.
+class RecordingContext : public frontend::ClientArrayCalls<RecordingContext>
+{
+public:
+    RecordingContext();
+    ~RecordingContext();
+
+    // The recording context of the calling thread. nullptr when the calls of the thread are executed directly.
+    static RecordingContext*& current()
+    {
+        static thread_local RecordingContext* context { nullptr };
+        return context;
+    }
+
+    // Records FUNC with the arguments. Returns a default value without executing FUNC when it is not recordable.
+    template <auto FUNC, typename... Args>
+    auto call(const Args... args)
+    {
+        using Result = decltype(FUNC(frontend::Arg<Args>::direct(args)...));
+        if constexpr (std::is_void_v<Result> && (frontend::Arg<Args>::RECORDABLE && ...))
+        {
+            frontend::record<FUNC>(m_buffer, args...);
+        }
+        else
+        {
+            SPDLOG_ERROR("A GL call which can't be recorded was used with a recording context. The call is ignored.");
+            return Result();
+        }
+    }
+
+    // The recorded calls are executed when the context is submitted, therefore there is nothing to wait for
+    void sync() { }
+    void flush() { }
+
+    // Hands the recorded calls over and continues the recording in the given (empty) buffer.
+    // The recording of the new buffer starts with the current client array state of this context.
+    void exchange(CommandBuffer& buffer);
+
+private:
+    friend class frontend::ClientArrayCalls<RecordingContext>;
+
+    // Records a draw call with a copy of the client arrays
+    void draw(GLenum mode, GLsizei count, GLint first, GLenum type, const GLvoid* indices);
+
+    CommandBuffer m_buffer {};
+};
+
+} // namespace rr
+
+#endif // _RECORDING_CONTEXT_HPP_
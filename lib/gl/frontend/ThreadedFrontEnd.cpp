@@ -0,0 +1,308 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "ThreadedFrontEnd.hpp"
+#include "RecordingContext.hpp"
+#include "glImpl.h"
+#include <algorithm>
+#include <spdlog/spdlog.h>
+#include <utility>
+
+namespace rr
+{
+
+// Executes the contexts of a frame which was ended with executeSubmissions()
+struct ThreadedFrontEnd::SubmissionsCall
+{
+    ThreadedFrontEnd* frontEnd;
+
+    static void execute(void* call)
+    {
+        static_cast<SubmissionsCall*>(call)->frontEnd->runSubmissions();
+    }
+};
+
+// Takes the snapshot of the state at the start of a frame
+struct ThreadedFrontEnd::SnapshotCall
+{
+    ThreadedFrontEnd* frontEnd;
+
+    static void execute(void* call)
+    {
+        ThreadedFrontEnd* frontEnd = static_cast<SnapshotCall*>(call)->frontEnd;
+        frontEnd->m_previousFrameState.clear();
+        frontEnd->m_snapshotter(frontEnd->m_previousFrameState);
+    }
+};
+
+ThreadedFrontEnd::~ThreadedFrontEnd()
+{
+    setThread(nullptr);
+}
+
+void ThreadedFrontEnd::setThread(IThreadRunner* runner)
+{
+    if (m_thread)
+    {
+        m_ring.close();
+        m_thread->wait();
+        m_ring.release();
+    }
+    m_thread = runner;
+    if (m_thread)
+    {
+        m_ring.open(RenderConfig::THREADED_FRONT_END_QUEUE_SIZE, RenderConfig::THREADED_FRONT_END_FLUSH_SIZE);
+        m_frameEnd = 0;
+        m_thread->run([this]()
+            { return m_ring.execute(); });
+    }
+}
+
+void ThreadedFrontEnd::endFrame()
+{
+    if (isEnabled())
+    {
+        m_ring.waitTillExecuted(m_frameEnd);
+        m_frameEnd = m_ring.getPosition();
+    }
+}
+
+void ThreadedFrontEnd::draw(GLenum mode, GLsizei count, GLint first, GLenum type, const GLvoid* indices)
+{
+    bool recorded { false };
+    if (m_frameReuse)
+    {
+        recorded = m_arrays.recordDraw(m_frame, mode, count, first, type, indices);
+    }
+    else if (isEnabled())
+    {
+        recorded = m_arrays.recordDraw(m_ring, mode, count, first, type, indices);
+    }
+    if (!recorded)
+    {
+        // Without a thread, too big for the ring or not understood by the front end. Let the back end read the arrays directly.
+        sync();
+        if (type != GL_NONE)
+        {
+            impl_glDrawElements(mode, count, type, indices);
+        }
+        else
+        {
+            impl_glDrawArrays(mode, first, count);
+        }
+        return;
+    }
+    if (!m_frameReuse)
+    {
+        // Let the back end start with the draw while the application records the next calls
+        m_ring.flush();
+    }
+}
+
+void ThreadedFrontEnd::submit(RecordingContext& context, const uint32_t order)
+{
+    CommandBuffer commands = takeFreeBuffer();
+    context.exchange(commands);
+    std::lock_guard<std::mutex> lock { m_submissionMutex };
+    m_submissions.push_back({ order, std::move(commands) });
+}
+
+void ThreadedFrontEnd::executeSubmissions()
+{
+    std::vector<Submission> submissions {};
+    {
+        std::lock_guard<std::mutex> lock { m_submissionMutex };
+        if (m_submissions.empty())
+        {
+            return;
+        }
+        std::stable_sort(m_submissions.begin(), m_submissions.end(), [](const Submission& a, const Submission& b)
+            { return a.order < b.order; });
+        submissions = std::move(m_submissions);
+        m_submissions.clear();
+    }
+    executeBuffers(std::move(submissions));
+    // The contexts have changed the client arrays. Set them back to the state of the application thread.
+    if (isEnabled())
+    {
+        m_arrays.recordState(m_ring);
+    }
+    else
+    {
+        m_arrays.apply();
+    }
+}
+
+void ThreadedFrontEnd::setFrameReuse(const bool enable, StateSnapshotter snapshotter)
+{
+    if (m_frameReuse)
+    {
+        executeFrame();
+    }
+    m_frameReuse = enable;
+    m_snapshotter = snapshotter;
+    m_frameComplete = true;
+    m_previousFrame = NO_FRAME;
+}
+
+bool ThreadedFrontEnd::commitFrame()
+{
+    if (!m_frameReuse)
+    {
+        return true;
+    }
+    bool submissions { false };
+    {
+        std::lock_guard<std::mutex> lock { m_submissionMutex };
+        submissions = !m_submissions.empty();
+    }
+    // Unrecorded calls in between or the calls of the recording contexts are not covered by the comparison
+    const uint64_t frame = (m_frameComplete && !submissions) ? m_frame.hash() : NO_FRAME;
+    m_frameComplete = true;
+    if ((frame != NO_FRAME) && (frame == m_previousFrame) && m_frame.equals(m_previousFrameCalls))
+    {
+        // The same calls only render the same image when they start with the same state. The state at the start
+        // of this frame is the state the back end has left after the previous frame.
+        if (isEnabled())
+        {
+            m_ring.waitTillIdle();
+        }
+        m_frameState.clear();
+        m_snapshotter(m_frameState);
+        if (m_frameState == m_previousFrameState)
+        {
+            m_frame.clear();
+            m_reusedFrames++;
+            return false;
+        }
+        // For instance a relative transformation. Compare the next frame with the state at the start of this one.
+        std::swap(m_frameState, m_previousFrameState);
+        executeFrame();
+        return true;
+    }
+    m_previousFrame = frame;
+    if (frame != NO_FRAME)
+    {
+        m_previousFrameCalls.copy(m_frame);
+        snapshotFrameStart();
+    }
+    executeFrame();
+    return true;
+}
+
+void ThreadedFrontEnd::executeFrame()
+{
+    if (m_frame.empty())
+    {
+        return;
+    }
+    std::vector<Submission> frame {};
+    frame.push_back({ 0, std::move(m_frame) });
+    m_frame = takeFreeBuffer();
+    executeBuffers(std::move(frame));
+}
+
+void ThreadedFrontEnd::snapshotFrameStart()
+{
+    if (isEnabled())
+    {
+        new (m_ring.allocate(sizeof(SnapshotCall), &SnapshotCall::execute)) SnapshotCall { this };
+        m_ring.commit();
+    }
+    else
+    {
+        m_previousFrameState.clear();
+        m_snapshotter(m_previousFrameState);
+    }
+}
+
+void ThreadedFrontEnd::executeBuffers(std::vector<Submission>&& buffers)
+{
+    {
+        std::lock_guard<std::mutex> lock { m_submissionMutex };
+        m_submittedFrames.push_back(std::move(buffers));
+    }
+    if (isEnabled())
+    {
+        new (m_ring.allocate(sizeof(SubmissionsCall), &SubmissionsCall::execute)) SubmissionsCall { this };
+        m_ring.commit();
+        m_ring.flush();
+    }
+    else
+    {
+        runSubmissions();
+    }
+}
+
+void ThreadedFrontEnd::runSubmissions()
+{
+    std::vector<Submission> submissions {};
+    {
+        std::lock_guard<std::mutex> lock { m_submissionMutex };
+        submissions = std::move(m_submittedFrames.front());
+        m_submittedFrames.pop_front();
+    }
+    for (Submission& submission : submissions)
+    {
+        submission.commands.execute();
+        submission.commands.clear();
+    }
+    std::lock_guard<std::mutex> lock { m_submissionMutex };
+    for (Submission& submission : submissions)
+    {
+        m_freeBuffers.push_back(std::move(submission.commands));
+    }
+}
+
+CommandBuffer ThreadedFrontEnd::takeFreeBuffer()
+{
+    std::lock_guard<std::mutex> lock { m_submissionMutex };
+    if (m_freeBuffers.empty())
+    {
+        return {};
+    }
+    CommandBuffer buffer = std::move(m_freeBuffers.back());
+    m_freeBuffers.pop_back();
+    return buffer;
+}
+
+std::size_t ThreadedFrontEnd::getParameterCount(GLenum pname)
+{
+    switch (pname)
+    {
+    case GL_AMBIENT:
+    case GL_DIFFUSE:
+    case GL_SPECULAR:
+    case GL_EMISSION:
+    case GL_AMBIENT_AND_DIFFUSE:
+    case GL_POSITION:
+    case GL_FOG_COLOR:
+    case GL_LIGHT_MODEL_AMBIENT:
+    case GL_TEXTURE_ENV_COLOR:
+    case GL_OBJECT_PLANE:
+    case GL_EYE_PLANE:
+    case GL_TEXTURE_BORDER_COLOR:
+        return 4;
+    case GL_SPOT_DIRECTION:
+    case GL_COLOR_INDEXES:
+        return 3;
+    default:
+        return 1;
+    }
+}
+
+} // namespace rr
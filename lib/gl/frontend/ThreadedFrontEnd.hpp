@@ -0,0 +1,385 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _THREADED_FRONT_END_HPP_
+#define _THREADED_FRONT_END_HPP_
+
+#include "IThreadRunner.hpp"
+#include "RenderConfigs.hpp"
+#include "StateSnapshot.hpp"
+#include "frontend/ClientArrays.hpp"
+#include "frontend/CommandBuffer.hpp"
+#include "frontend/CommandRing.hpp"
+#include "gl.h"
+#include "glImpl.h"
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace rr
+{
+
+// Argument which points to up to N elements which are read by the call. The elements are copied into the record.
+template <typename T, std::size_t N>
+struct ArrayArg
+{
+    const T* ptr;
+    std::size_t count { N };
+};
+
+// Pointer argument which is only stored by the call and not dereferenced (like the pointer of glVertexPointer)
+struct AddressArg
+{
+    const GLvoid* ptr;
+};
+
+namespace frontend
+{
+// Describes how an argument is stored in a record (Stored, store()) and passed to the function from a record
+// (pass()) or directly (direct()). Only arithmetic arguments and the marked pointers can be recorded.
+template <typename T>
+struct Arg
+{
+    static constexpr bool RECORDABLE { std::is_arithmetic_v<T> };
+    using Stored = T;
+    static T store(const T arg) { return arg; }
+    static T pass(const T arg) { return arg; }
+    static T direct(const T arg) { return arg; }
+};
+
+template <typename T, std::size_t N>
+struct Arg<ArrayArg<T, N>>
+{
+    static constexpr bool RECORDABLE { true };
+    using Stored = std::array<T, N>;
+    static Stored store(const ArrayArg<T, N> arg)
+    {
+        Stored stored {};
+        for (std::size_t i = 0; i < arg.count; i++)
+        {
+            stored[i] = arg.ptr[i];
+        }
+        return stored;
+    }
+    static const T* pass(const Stored& arg) { return arg.data(); }
+    static const T* direct(const ArrayArg<T, N> arg) { return arg.ptr; }
+};
+
+template <>
+struct Arg<AddressArg>
+{
+    static constexpr bool RECORDABLE { true };
+    using Stored = const GLvoid*;
+    static Stored store(const AddressArg arg) { return arg.ptr; }
+    static Stored pass(const Stored arg) { return arg; }
+    static Stored direct(const AddressArg arg) { return arg.ptr; }
+};
+
+template <auto FUNC, typename... Args>
+struct Call
+{
+    std::tuple<typename Arg<Args>::Stored...> args;
+
+    static void execute(void* call)
+    {
+        static_cast<Call*>(call)->invoke(std::index_sequence_for<Args...> {});
+    }
+
+    template <std::size_t... I>
+    void invoke(std::index_sequence<I...>)
+    {
+        FUNC(Arg<Args>::pass(std::get<I>(args))...);
+    }
+};
+
+// Records FUNC with the arguments into a CommandRing or CommandBuffer
+template <auto FUNC, typename Storage, typename... Args>
+void record(Storage& storage, const Args... args)
+{
+    using CallType = Call<FUNC, Args...>;
+    new (storage.allocate(sizeof(CallType), &CallType::execute)) CallType { { Arg<Args>::store(args)... } };
+    storage.commit();
+}
+
+// Client array calls and draw calls of a recorder (ThreadedFrontEnd and RecordingContext). The client array state
+// is tracked here to copy the arrays at the draw calls. The recorder provides call<FUNC>() to record a call and
+// draw() to record a valid draw call with its arrays.
+template <typename TRecorder>
+class ClientArrayCalls
+{
+public:
+    void vertexPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+    {
+        m_arrays.vertexPointer(size, type, stride, pointer);
+        recorder().template call<impl_glVertexPointer>(size, type, stride, AddressArg { pointer });
+    }
+
+    void colorPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+    {
+        m_arrays.colorPointer(size, type, stride, pointer);
+        recorder().template call<impl_glColorPointer>(size, type, stride, AddressArg { pointer });
+    }
+
+    void normalPointer(GLenum type, GLsizei stride, const GLvoid* pointer)
+    {
+        m_arrays.normalPointer(type, stride, pointer);
+        recorder().template call<impl_glNormalPointer>(type, stride, AddressArg { pointer });
+    }
+
+    void texCoordPointer(GLint size, GLenum type, GLsizei stride, const GLvoid* pointer)
+    {
+        m_arrays.texCoordPointer(size, type, stride, pointer);
+        recorder().template call<impl_glTexCoordPointer>(size, type, stride, AddressArg { pointer });
+    }
+
+    void clientActiveTexture(GLenum texture)
+    {
+        m_arrays.clientActiveTexture(texture);
+        recorder().template call<impl_glClientActiveTexture>(texture);
+    }
+
+    void setClientState(GLenum cap, bool enable)
+    {
+        m_arrays.setClientState(cap, enable);
+        if (enable)
+        {
+            recorder().template call<impl_glEnableClientState>(cap);
+        }
+        else
+        {
+            recorder().template call<impl_glDisableClientState>(cap);
+        }
+    }
+
+    void bindBuffer(GLenum target, GLuint buffer)
+    {
+        m_arrays.bindBuffer(target, buffer);
+        recorder().template call<impl_glBindBuffer>(target, buffer);
+    }
+
+    void deleteBuffers(GLsizei n, const GLuint* buffers)
+    {
+        if (n < 0)
+        {
+            recorder().template call<impl_glDeleteBuffers>(n, ArrayArg<GLuint, 1> { buffers, 0 });
+            return;
+        }
+        // Deleted one by one, which makes the calls recordable
+        for (GLsizei i = 0; i < n; i++)
+        {
+            m_arrays.deleteBuffer(buffers[i]);
+            recorder().template call<impl_glDeleteBuffers>(1, ArrayArg<GLuint, 1> { &buffers[i] });
+        }
+    }
+
+    void drawArrays(GLenum mode, GLint first, GLsizei count)
+    {
+        if ((first < 0) || (count <= 0))
+        {
+            // Does not read the arrays, the execution only sets the error
+            recorder().template call<impl_glDrawArrays>(mode, first, count);
+            return;
+        }
+        recorder().draw(mode, count, first, GL_NONE, nullptr);
+    }
+
+    void drawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices)
+    {
+        if ((count <= 0) || ((indices == nullptr) && !m_arrays.hasElementArrayBuffer()) || ((type != GL_UNSIGNED_BYTE) && (type != GL_UNSIGNED_SHORT) && (type != GL_UNSIGNED_INT)))
+        {
+            // Does not read the indices, the execution only sets the error
+            recorder().template call<impl_glDrawElements>(mode, count, type, AddressArg { indices });
+            return;
+        }
+        recorder().draw(mode, count, 0, type, indices);
+    }
+
+protected:
+    ClientArrays m_arrays {};
+
+private:
+    TRecorder& recorder() { return static_cast<TRecorder&>(*this); }
+};
+} // namespace frontend
+
+class RecordingContext;
+
+// Records the GL calls of the application and executes them in an own thread (the back end). Calls without
+// a return value and without pointers into the application memory are recorded and return immediately. The
+// data of pointer arguments with a known size is copied into the record, as well as the client arrays of a
+// draw call. All other calls wait till the back end has executed the recorded calls and are then executed
+// directly in the calling thread. Without a thread, all calls are directly executed.
+class ThreadedFrontEnd : public frontend::ClientArrayCalls<ThreadedFrontEnd>
+{
+public:
+    ~ThreadedFrontEnd();
+
+    // Sets the runner of the back end. The runner must execute the operation concurrently to the calling thread
+    // and is occupied till the thread is disabled with a nullptr. Must be called from the application thread.
+    void setThread(IThreadRunner* runner);
+
+    bool isEnabled() const { return m_thread != nullptr; }
+
+    // Executes FUNC with the arguments. Is recorded if the arguments can be stored, otherwise synchronized.
+    template <auto FUNC, typename... Args>
+    auto call(const Args... args)
+    {
+        if constexpr (isRecordable<FUNC, Args...>())
+        {
+            if (m_frameReuse)
+            {
+                frontend::record<FUNC>(m_frame, args...);
+                return;
+            }
+        }
+        return execute<FUNC>(args...);
+    }
+
+    // Same as call(), but bypasses the recording of the frame for the frame reuse
+    template <auto FUNC, typename... Args>
+    auto execute(const Args... args)
+    {
+        if constexpr (isRecordable<FUNC, Args...>())
+        {
+            if (isEnabled())
+            {
+                frontend::record<FUNC>(m_ring, args...);
+                return;
+            }
+        }
+        else
+        {
+            sync();
+        }
+        return FUNC(frontend::Arg<Args>::direct(args)...);
+    }
+
+    // Waits till the back end has executed all recorded calls. With the frame reuse, the frame recorded so far is
+    // executed before and the frame can't be reused anymore, because the calls are mixed with unrecorded calls.
+    void sync()
+    {
+        if (m_frameReuse)
+        {
+            executeFrame();
+            m_frameComplete = false;
+        }
+        if (isEnabled())
+        {
+            m_ring.waitTillIdle();
+        }
+    }
+
+    // Makes the recorded calls visible to the back end
+    void flush()
+    {
+        if (isEnabled())
+        {
+            m_ring.flush();
+        }
+    }
+
+    // Marks the end of a frame. Waits till the back end has reached the end of the previous frame, therefore the
+    // application can only record one frame ahead.
+    void endFrame();
+
+    // Takes the calls recorded by the context. They are executed with the next executeSubmissions(), ordered by
+    // the order. Submissions with the same order keep the order in which they were submitted. Can be called
+    // from any thread, but the context must not record while it is submitted.
+    void submit(RecordingContext& context, const uint32_t order);
+
+    // Executes the submitted contexts after the calls recorded so far. Must be called from the application thread.
+    void executeSubmissions();
+
+    // Takes a snapshot of the state of the back end which is used by the executed calls
+    using StateSnapshotter = void (*)(StateSnapshot& snapshot);
+
+    // Enables the frame reuse. The calls of the application thread are recorded till the end of the frame and
+    // compared with the previous frame. An identical frame which starts with the same state does not need to be
+    // executed (see commitFrame()). The snapshotter is executed by the back end at the start of the frames.
+    void setFrameReuse(const bool enable, StateSnapshotter snapshotter);
+
+    // Ends the recording of a frame. Returns false when the frame has the same calls as the previous frame and
+    // starts with the same state. Then its calls are dropped, because they would render the same image again.
+    // Otherwise the calls are executed. Always true without the frame reuse.
+    bool commitFrame();
+
+    // Number of frames which were identical to their previous frame
+    std::size_t getReusedFrames() const { return m_reusedFrames; }
+
+    // Number of elements of the vector parameters of glLightfv, glMaterialfv, glFogfv, ...
+    static std::size_t getParameterCount(GLenum pname);
+
+private:
+    friend class frontend::ClientArrayCalls<ThreadedFrontEnd>;
+
+    template <auto FUNC, typename... Args>
+    static constexpr bool isRecordable()
+    {
+        using Result = decltype(FUNC(frontend::Arg<Args>::direct(std::declval<Args>())...));
+        return std::is_void_v<Result> && (frontend::Arg<Args>::RECORDABLE && ...);
+    }
+
+    struct Submission
+    {
+        uint32_t order;
+        CommandBuffer commands;
+    };
+
+    struct SubmissionsCall;
+    struct SnapshotCall;
+
+    void draw(GLenum mode, GLsizei count, GLint first, GLenum type, const GLvoid* indices);
+    void executeFrame();
+    void snapshotFrameStart();
+    void executeBuffers(std::vector<Submission>&& buffers);
+    void runSubmissions();
+    CommandBuffer takeFreeBuffer();
+
+    IThreadRunner* m_thread { nullptr };
+    CommandRing m_ring {};
+    std::size_t m_frameEnd { 0 };
+
+    // The submitted contexts of the current frame, the frames which wait for their execution and the empty
+    // buffers which are handed to the contexts for the next recording
+    std::mutex m_submissionMutex {};
+    std::vector<Submission> m_submissions {};
+    std::deque<std::vector<Submission>> m_submittedFrames {};
+    std::vector<CommandBuffer> m_freeBuffers {};
+
+    // Frame reuse. A frame is only comparable when all of its calls were recorded. The calls of the previous
+    // comparable frame are kept with the state at its start.
+    static constexpr uint64_t NO_FRAME { 0 };
+    bool m_frameReuse { false };
+    bool m_frameComplete { true };
+    StateSnapshotter m_snapshotter { nullptr };
+    uint64_t m_previousFrame { NO_FRAME };
+    CommandBuffer m_previousFrameCalls {};
+    StateSnapshot m_previousFrameState {};
+    StateSnapshot m_frameState {};
+    CommandBuffer m_frame {};
+    std::size_t m_reusedFrames { 0 };
+};
+
+} // namespace rr
+
+#endif // _THREADED_FRONT_END_HPP_
@@ -1,6 +1,8 @@
 #ifndef __gl_h_
 #define __gl_h_
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -72,6 +74,8 @@ extern "C"
     typedef float GLclampf;
     typedef double GLdouble;
     typedef double GLclampd;
+    typedef ptrdiff_t GLsizeiptr;
+    typedef ptrdiff_t GLintptr;
 
 // Boolean values
 #define GL_FALSE 0x0
@@ -143,6 +147,31 @@ extern "C"
 #define GL_T2F_N3F_V3F 0x2A2B
 #define GL_T2F_C4F_N3F_V3F 0x2A2C
 #define GL_T4F_C4F_N3F_V4F 0x2A2D
+#define GL_ARRAY_ELEMENT_LOCK_FIRST_EXT 0x81A8
+#define GL_ARRAY_ELEMENT_LOCK_COUNT_EXT 0x81A9
+
+// Buffer objects
+#define GL_ARRAY_BUFFER 0x8892
+#define GL_ELEMENT_ARRAY_BUFFER 0x8893
+#define GL_ARRAY_BUFFER_BINDING 0x8894
+#define GL_ELEMENT_ARRAY_BUFFER_BINDING 0x8895
+#define GL_STREAM_DRAW 0x88E0
+#define GL_STREAM_READ 0x88E1
+#define GL_STREAM_COPY 0x88E2
+#define GL_STATIC_DRAW 0x88E4
+#define GL_STATIC_READ 0x88E5
+#define GL_STATIC_COPY 0x88E6
+#define GL_DYNAMIC_DRAW 0x88E8
+#define GL_DYNAMIC_READ 0x88E9
+#define GL_DYNAMIC_COPY 0x88EA
+#define GL_READ_ONLY 0x88B8
+#define GL_WRITE_ONLY 0x88B9
+#define GL_READ_WRITE 0x88BA
+#define GL_BUFFER_SIZE 0x8764
+#define GL_BUFFER_USAGE 0x8765
+#define GL_BUFFER_ACCESS 0x88BB
+#define GL_BUFFER_MAPPED 0x88BC
+#define GL_BUFFER_MAP_POINTER 0x88BD
 
 // Matrix Mode
 #define GL_MATRIX_MODE 0x0BA0
@@ -1301,6 +1330,16 @@ extern "C"
     GLAPI_WRAPPER void APIENTRY glActiveStencilFaceEXT(GLenum face);
     GLAPI_WRAPPER void APIENTRY glBlendEquation(GLenum mode);
     GLAPI_WRAPPER void APIENTRY glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
+    GLAPI_WRAPPER void APIENTRY glBindBuffer(GLenum target, GLuint buffer);
+    GLAPI_WRAPPER void APIENTRY glDeleteBuffers(GLsizei n, const GLuint* buffers);
+    GLAPI_WRAPPER void APIENTRY glGenBuffers(GLsizei n, GLuint* buffers);
+    GLAPI_WRAPPER GLboolean APIENTRY glIsBuffer(GLuint buffer);
+    GLAPI_WRAPPER void APIENTRY glBufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage);
+    GLAPI_WRAPPER void APIENTRY glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid* data);
+    GLAPI_WRAPPER void APIENTRY glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, GLvoid* data);
+    GLAPI_WRAPPER GLvoid* APIENTRY glMapBuffer(GLenum target, GLenum access);
+    GLAPI_WRAPPER GLboolean APIENTRY glUnmapBuffer(GLenum target);
+    GLAPI_WRAPPER void APIENTRY glGetBufferParameteriv(GLenum target, GLenum pname, GLint* params);
     // -------------------------------------------------------
 
 #ifdef __cplusplus
@@ -21,11 +21,13 @@
 #include "TextureConverter.hpp"
 #include "glTypeConverters.h"
 #include "pixelpipeline/PixelPipeline.hpp"
+#include "vertexpipeline/BufferObjects.hpp"
 #include "vertexpipeline/VertexArray.hpp"
 #include "vertexpipeline/VertexPipeline.hpp"
 #include "vertexpipeline/VertexQueue.hpp"
 #include <cmath>
 #include <cstring>
+#include <optional>
 #include <spdlog/spdlog.h>
 
 #pragma GCC diagnostic ignored "-Wunused-parameter"
@@ -1113,7 +1115,7 @@ GLAPI void APIENTRY impl_glGetFloatv(GLenum pname, GLfloat* params)
     switch (pname)
     {
     case GL_MODELVIEW_MATRIX:
-        memcpy(params, RIXGL::getInstance().pipeline().getMatrixStore().getModelView().data(), 16 * 4);
+        memcpy(params, RIXGL::getInstance().pipeline().readMatrixStore().getModelView().data(), 16 * 4);
         break;
     default:
         SPDLOG_DEBUG("glGetFloatv redirected to glGetIntegerv");
@@ -1159,6 +1161,18 @@ GLAPI void APIENTRY impl_glGetIntegerv(GLenum pname, GLint* params)
     case GL_STENCIL_BITS:
         *params = rr::StencilReg::MAX_STENCIL_VAL;
         break;
+    case GL_ARRAY_ELEMENT_LOCK_FIRST_EXT:
+        *params = static_cast<GLint>(RIXGL::getInstance().pipeline().getCompiledVertexArray().getFirst());
+        break;
+    case GL_ARRAY_ELEMENT_LOCK_COUNT_EXT:
+        *params = static_cast<GLint>(RIXGL::getInstance().pipeline().getCompiledVertexArray().getCount());
+        break;
+    case GL_ARRAY_BUFFER_BINDING:
+        *params = static_cast<GLint>(RIXGL::getInstance().vertexArray().getArrayBufferName());
+        break;
+    case GL_ELEMENT_ARRAY_BUFFER_BINDING:
+        *params = static_cast<GLint>(RIXGL::getInstance().vertexArray().getElementArrayBufferName());
+        break;
     default:
         *params = 0;
         break;
@@ -1449,7 +1463,7 @@ GLAPI void APIENTRY impl_glLightfv(GLenum light, GLenum pname, const GLfloat* pa
     {
         Vec4 lightPos { params };
         Vec4 lightPosTransformed {};
-        RIXGL::getInstance().pipeline().getMatrixStore().getModelView().transform(lightPosTransformed, lightPos);
+        RIXGL::getInstance().pipeline().readMatrixStore().getModelView().transform(lightPosTransformed, lightPos);
         RIXGL::getInstance().pipeline().getLighting().setPosLight(light - GL_LIGHT0, lightPosTransformed);
         break;
     }
@@ -3581,29 +3595,39 @@ GLAPI void APIENTRY impl_glDrawArrays(GLenum mode, GLint first, GLsizei count)
     RIXGL::getInstance().vertexArray().setDrawMode(convertDrawMode(mode));
     RIXGL::getInstance().vertexArray().enableIndices(false);
 
-    RIXGL::getInstance().pipeline().drawObj(RIXGL::getInstance().vertexArray().renderObj());
+    const RenderObj& obj = RIXGL::getInstance().vertexArray().renderObj();
+    if ((first >= 0) && (count > 0) && (obj.isBufferMapped() || ((static_cast<std::size_t>(first) + count) > obj.getBufferedVertexCount())))
+    {
+        RIXGL::getInstance().setError(GL_INVALID_OPERATION);
+        SPDLOG_ERROR("glDrawArrays reads outside of a buffer object or from a mapped buffer");
+        return;
+    }
+
+    RIXGL::getInstance().pipeline().drawObj(obj);
 }
 
 GLAPI void APIENTRY impl_glDrawElements(GLenum mode, GLsizei count, GLenum type, const GLvoid* indices)
 {
     SPDLOG_DEBUG("glDrawElements mode 0x{:X} count {} type 0x{:X} called", mode, count, type);
     RIXGL::getInstance().setError(GL_NO_ERROR);
+    Type indicesType { Type::BYTE };
     switch (type)
     {
     case GL_UNSIGNED_BYTE:
-        RIXGL::getInstance().vertexArray().setIndicesType(Type::BYTE);
+        indicesType = Type::BYTE;
         break;
     case GL_UNSIGNED_SHORT:
-        RIXGL::getInstance().vertexArray().setIndicesType(Type::UNSIGNED_SHORT);
+        indicesType = Type::UNSIGNED_SHORT;
         break;
     case GL_UNSIGNED_INT:
-        RIXGL::getInstance().vertexArray().setIndicesType(Type::UNSIGNED_INT);
+        indicesType = Type::UNSIGNED_INT;
         break;
     default:
         RIXGL::getInstance().setError(GL_INVALID_ENUM);
         SPDLOG_WARN("glDrawElements type 0x{:X} not supported", type);
         return;
     }
+    RIXGL::getInstance().vertexArray().setIndicesType(indicesType);
 
     RIXGL::getInstance().vertexArray().reset();
 
@@ -3612,9 +3636,27 @@ GLAPI void APIENTRY impl_glDrawElements(GLenum mode, GLsizei count, GLenum type,
     RIXGL::getInstance().vertexArray().setIndicesPointer(indices);
     RIXGL::getInstance().vertexArray().enableIndices(true);
 
+    // The indices must stay within the buffer objects. Indices in a buffer are read from the buffer, the range of
+    // static buffers is cached. Client indices are only scanned when an array is stored in a buffer.
+    const RenderObj& obj = RIXGL::getInstance().vertexArray().renderObj();
+    BufferObject* elementArrayBuffer = RIXGL::getInstance().vertexArray().getElementArrayBuffer();
+    const std::size_t vertexCount = obj.getBufferedVertexCount();
+    if ((count > 0) && (elementArrayBuffer || (vertexCount != SIZE_MAX)))
+    {
+        const std::optional<BufferObject::IndexRange> range = elementArrayBuffer
+            ? elementArrayBuffer->getIndexRange(indicesType, reinterpret_cast<std::size_t>(indices), count)
+            : BufferObject::scanIndexRange(indicesType, indices, count);
+        if (!range || (range->max >= vertexCount) || obj.isBufferMapped())
+        {
+            RIXGL::getInstance().setError(GL_INVALID_OPERATION);
+            SPDLOG_ERROR("glDrawElements reads outside of a buffer object or from a mapped buffer");
+            return;
+        }
+    }
+
     if (RIXGL::getInstance().getError() == GL_NO_ERROR)
     {
-        RIXGL::getInstance().pipeline().drawObj(RIXGL::getInstance().vertexArray().renderObj());
+        RIXGL::getInstance().pipeline().drawObj(obj);
     }
 }
 
@@ -4311,12 +4353,31 @@ GLAPI void APIENTRY impl_glMultTransposeMatrixd(const GLdouble* m)
 // -------------------------------------------------------
 GLAPI void APIENTRY impl_glLockArrays(GLint first, GLsizei count)
 {
-    SPDLOG_WARN("glLockArrays not implemented");
+    SPDLOG_DEBUG("glLockArrays first {} count {} called", first, count);
+    if ((first < 0) || (count <= 0))
+    {
+        RIXGL::getInstance().setError(GL_INVALID_VALUE);
+        return;
+    }
+    if (RIXGL::getInstance().pipeline().getCompiledVertexArray().isLocked())
+    {
+        RIXGL::getInstance().setError(GL_INVALID_OPERATION);
+        return;
+    }
+    RIXGL::getInstance().setError(GL_NO_ERROR);
+    RIXGL::getInstance().pipeline().lockArrays(first, count, RIXGL::getInstance().vertexArray().renderObj());
 }
 
 GLAPI void APIENTRY impl_glUnlockArrays()
 {
-    SPDLOG_WARN("glUnlockArrays not implemented");
+    SPDLOG_DEBUG("glUnlockArrays called");
+    if (!RIXGL::getInstance().pipeline().getCompiledVertexArray().isLocked())
+    {
+        RIXGL::getInstance().setError(GL_INVALID_OPERATION);
+        return;
+    }
+    RIXGL::getInstance().setError(GL_NO_ERROR);
+    RIXGL::getInstance().pipeline().unlockArrays();
 }
 
 GLAPI void APIENTRY impl_glActiveStencilFaceEXT(GLenum face)
@@ -4346,3 +4407,199 @@ GLAPI void APIENTRY impl_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRG
 {
     SPDLOG_WARN("glBlendFuncSeparate not implemented");
 }
+
+GLAPI void APIENTRY impl_glBindBuffer(GLenum target, GLuint buffer)
+{
+    SPDLOG_DEBUG("glBindBuffer target 0x{:X} buffer {} called", target, buffer);
+    RIXGL::getInstance().setError(GL_NO_ERROR);
+    // The first bind of a name creates the buffer
+    switch (target)
+    {
+    case GL_ARRAY_BUFFER:
+        RIXGL::getInstance().vertexArray().bindArrayBuffer(buffer, RIXGL::getInstance().bufferObjects().getOrCreate(buffer));
+        break;
+    case GL_ELEMENT_ARRAY_BUFFER:
+        RIXGL::getInstance().vertexArray().bindElementArrayBuffer(buffer, RIXGL::getInstance().bufferObjects().getOrCreate(buffer));
+        break;
+    default:
+        SPDLOG_WARN("glBindBuffer target 0x{:X} not supported", target);
+        RIXGL::getInstance().setError(GL_INVALID_ENUM);
+        break;
+    }
+}
+
+GLAPI void APIENTRY impl_glDeleteBuffers(GLsizei n, const GLuint* buffers)
+{
+    SPDLOG_DEBUG("glDeleteBuffers {} called", n);
+    RIXGL::getInstance().setError(GL_NO_ERROR);
+    if (n < 0)
+    {
+        RIXGL::getInstance().setError(GL_INVALID_VALUE);
+        return;
+    }
+
+    for (GLsizei i = 0; i < n; i++)
+    {
+        // Zeros and names which are no buffers are silently ignored
+        if (BufferObject* obj = RIXGL::getInstance().bufferObjects().get(buffers[i]))
+        {
+            RIXGL::getInstance().vertexArray().unbindBuffer(obj);
+        }
+        RIXGL::getInstance().bufferObjects().remove(buffers[i]);
+    }
+}
+
+GLAPI void APIENTRY impl_glGenBuffers(GLsizei n, GLuint* buffers)
+{
+    SPDLOG_DEBUG("glGenBuffers {} called", n);
+    RIXGL::getInstance().setError(GL_NO_ERROR);
+    if (n < 0)
+    {
+        RIXGL::getInstance().setError(GL_INVALID_VALUE);
+        SPDLOG_ERROR("glGenBuffers n < 0");
+        return;
+    }
+
+    for (GLsizei i = 0; i < n; i++)
+    {
+        buffers[i] = RIXGL::getInstance().bufferObjects().genName();
+    }
+}
+
+GLAPI GLboolean APIENTRY impl_glIsBuffer(GLuint buffer)
+{
+    SPDLOG_DEBUG("glIsBuffer {} called", buffer);
+    return RIXGL::getInstance().bufferObjects().isBuffer(buffer) ? GL_TRUE : GL_FALSE;
+}
+
+GLAPI void APIENTRY impl_glBufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage)
+{
+    SPDLOG_DEBUG("glBufferData target 0x{:X} size {} usage 0x{:X} called", target, size, usage);
+    RIXGL::getInstance().setError(GL_NO_ERROR);
+    const BufferObject::Usage bufferUsage = convertBufferUsage(usage);
+    BufferObject* obj = getBoundBuffer(target);
+    if ((RIXGL::getInstance().getError() != GL_NO_ERROR) || !obj)
+    {
+        SPDLOG_ERROR("glBufferData no buffer bound or invalid usage");
+        return;
+    }
+    if (size < 0)
+    {
+        RIXGL::getInstance().setError(GL_INVALID_VALUE);
+        SPDLOG_ERROR("glBufferData size < 0");
+        return;
+    }
+    obj->setData(data, size, bufferUsage);
+}
+
+GLAPI void APIENTRY impl_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid* data)
+{
+    SPDLOG_DEBUG("glBufferSubData target 0x{:X} offset {} size {} called", target, offset, size);
+    RIXGL::getInstance().setError(GL_NO_ERROR);
+    BufferObject* obj = getBoundBuffer(target);
+    if (!obj)
+    {
+        return;
+    }
+    if ((offset < 0) || (size < 0) || !obj->setSubData(offset, size, data))
+    {
+        RIXGL::getInstance().setError(GL_INVALID_VALUE);
+        SPDLOG_ERROR("glBufferSubData range outside of the buffer");
+    }
+}
+
+GLAPI void APIENTRY impl_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, GLvoid* data)
+{
+    SPDLOG_DEBUG("glGetBufferSubData target 0x{:X} offset {} size {} called", target, offset, size);
+    RIXGL::getInstance().setError(GL_NO_ERROR);
+    BufferObject* obj = getBoundBuffer(target);
+    if (!obj)
+    {
+        return;
+    }
+    if ((offset < 0) || (size < 0) || !obj->getSubData(offset, size, data))
+    {
+        RIXGL::getInstance().setError(GL_INVALID_VALUE);
+        SPDLOG_ERROR("glGetBufferSubData range outside of the buffer");
+    }
+}
+
+GLAPI GLvoid* APIENTRY impl_glMapBuffer(GLenum target, GLenum access)
+{
+    SPDLOG_DEBUG("glMapBuffer target 0x{:X} access 0x{:X} called", target, access);
+    RIXGL::getInstance().setError(GL_NO_ERROR);
+    if ((access != GL_READ_ONLY) && (access != GL_WRITE_ONLY) && (access != GL_READ_WRITE))
+    {
+        RIXGL::getInstance().setError(GL_INVALID_ENUM);
+        return nullptr;
+    }
+    BufferObject* obj = getBoundBuffer(target);
+    if (!obj)
+    {
+        return nullptr;
+    }
+    GLvoid* data = obj->map();
+    if (!data)
+    {
+        RIXGL::getInstance().setError(GL_INVALID_OPERATION);
+        SPDLOG_ERROR("glMapBuffer buffer is already mapped");
+    }
+    return data;
+}
+
+GLAPI GLboolean APIENTRY impl_glUnmapBuffer(GLenum target)
+{
+    SPDLOG_DEBUG("glUnmapBuffer target 0x{:X} called", target);
+    RIXGL::getInstance().setError(GL_NO_ERROR);
+    BufferObject* obj = getBoundBuffer(target);
+    if (!obj)
+    {
+        return GL_FALSE;
+    }
+    if (!obj->unmap())
+    {
+        RIXGL::getInstance().setError(GL_INVALID_OPERATION);
+        return GL_FALSE;
+    }
+    return GL_TRUE;
+}
+
+GLAPI void APIENTRY impl_glGetBufferParameteriv(GLenum target, GLenum pname, GLint* params)
+{
+    SPDLOG_DEBUG("glGetBufferParameteriv target 0x{:X} pname 0x{:X} called", target, pname);
+    RIXGL::getInstance().setError(GL_NO_ERROR);
+    const BufferObject* obj = getBoundBuffer(target);
+    if (!obj)
+    {
+        return;
+    }
+    switch (pname)
+    {
+    case GL_BUFFER_SIZE:
+        *params = static_cast<GLint>(obj->getSize());
+        break;
+    case GL_BUFFER_USAGE:
+        switch (obj->getUsage())
+        {
+        case BufferObject::Usage::STREAM:
+            *params = GL_STREAM_DRAW;
+            break;
+        case BufferObject::Usage::DYNAMIC:
+            *params = GL_DYNAMIC_DRAW;
+            break;
+        default:
+            *params = GL_STATIC_DRAW;
+            break;
+        }
+        break;
+    case GL_BUFFER_ACCESS:
+        *params = GL_READ_WRITE;
+        break;
+    case GL_BUFFER_MAPPED:
+        *params = obj->isMapped() ? GL_TRUE : GL_FALSE;
+        break;
+    default:
+        RIXGL::getInstance().setError(GL_INVALID_ENUM);
+        break;
+    }
+}
@@ -450,6 +450,16 @@ extern "C"
     GLAPI void APIENTRY impl_glActiveStencilFaceEXT(GLenum face);
     GLAPI void APIENTRY impl_glBlendEquation(GLenum mode);
     GLAPI void APIENTRY impl_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
+    GLAPI void APIENTRY impl_glBindBuffer(GLenum target, GLuint buffer);
+    GLAPI void APIENTRY impl_glDeleteBuffers(GLsizei n, const GLuint* buffers);
+    GLAPI void APIENTRY impl_glGenBuffers(GLsizei n, GLuint* buffers);
+    GLAPI GLboolean APIENTRY impl_glIsBuffer(GLuint buffer);
+    GLAPI void APIENTRY impl_glBufferData(GLenum target, GLsizeiptr size, const GLvoid* data, GLenum usage);
+    GLAPI void APIENTRY impl_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const GLvoid* data);
+    GLAPI void APIENTRY impl_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, GLvoid* data);
+    GLAPI GLvoid* APIENTRY impl_glMapBuffer(GLenum target, GLenum access);
+    GLAPI GLboolean APIENTRY impl_glUnmapBuffer(GLenum target);
+    GLAPI void APIENTRY impl_glGetBufferParameteriv(GLenum target, GLenum pname, GLint* params);
     // -------------------------------------------------------
 
 #ifdef __cplusplus
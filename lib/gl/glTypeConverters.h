@@ -24,6 +24,7 @@
 #include "pixelpipeline/PixelPipeline.hpp"
 #include "pixelpipeline/Texture.hpp"
 #include "transform/MatrixStore.hpp"
+#include "vertexpipeline/BufferObjects.hpp"
 #include "vertexpipeline/VertexArray.hpp"
 #include "vertexpipeline/VertexQueue.hpp"
 #include <algorithm>
@@ -249,6 +250,53 @@ void setClientState(const GLenum array, bool enable)
     }
 }
 
+BufferObject::Usage convertBufferUsage(GLenum usage)
+{
+    switch (usage)
+    {
+    case GL_STREAM_DRAW:
+    case GL_STREAM_READ:
+    case GL_STREAM_COPY:
+        return BufferObject::Usage::STREAM;
+    case GL_STATIC_DRAW:
+    case GL_STATIC_READ:
+    case GL_STATIC_COPY:
+        return BufferObject::Usage::STATIC;
+    case GL_DYNAMIC_DRAW:
+    case GL_DYNAMIC_READ:
+    case GL_DYNAMIC_COPY:
+        return BufferObject::Usage::DYNAMIC;
+    default:
+        SPDLOG_WARN("convertBufferUsage 0x{:X} not suppored", usage);
+        RIXGL::getInstance().setError(GL_INVALID_ENUM);
+        return BufferObject::Usage::STATIC;
+    }
+}
+
+// Returns the buffer bound to target. Sets an error and returns a nullptr when no buffer is bound.
+BufferObject* getBoundBuffer(GLenum target)
+{
+    BufferObject* buffer { nullptr };
+    switch (target)
+    {
+    case GL_ARRAY_BUFFER:
+        buffer = RIXGL::getInstance().vertexArray().getArrayBuffer();
+        break;
+    case GL_ELEMENT_ARRAY_BUFFER:
+        buffer = RIXGL::getInstance().vertexArray().getElementArrayBuffer();
+        break;
+    default:
+        SPDLOG_WARN("getBoundBuffer 0x{:X} not suppored", target);
+        RIXGL::getInstance().setError(GL_INVALID_ENUM);
+        return nullptr;
+    }
+    if (!buffer)
+    {
+        RIXGL::getInstance().setError(GL_INVALID_OPERATION);
+    }
+    return buffer;
+}
+
 Type convertType(GLenum type)
 {
     switch (type)
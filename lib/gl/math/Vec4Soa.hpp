@@ -0,0 +1,134 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef VEC4SOA_HPP
+#define VEC4SOA_HPP
+#include "math/Mat44.hpp"
+#include "math/Vec.hpp"
+#include <array>
+#include <cstddef>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace rr
+{
+
+// A block of N Vec4 in a structure of arrays layout. A vertex transformation on this layout is a sequence of
+// vertical operations, which maps directly to SIMD instructions: Every lane transforms another vector.
+// The instruction set is selected at build time: AVX (8 lanes), SSE2 or NEON (4 lanes) or scalar code.
+// The operations are executed in the same order as in Mat44::transform(), therefore the results are bit
+// identical to it as long as the compiler does not contract the multiplications and additions differently
+// into FMAs. The transformBenchmark example checks the deviation against a bound of 4 ULP.
+template <std::size_t N>
+class Vec4Soa
+{
+public:
+#if defined(__AVX__)
+    static constexpr std::size_t LANES { 8 };
+#elif defined(__SSE2__) || defined(_M_X64) || defined(__ARM_NEON)
+    static constexpr std::size_t LANES { 4 };
+#else
+    static constexpr std::size_t LANES { 1 };
+#endif
+    static_assert((N % LANES) == 0, "The block size must be a multiple of the SIMD width");
+
+    void set(const std::size_t i, const Vec4& v)
+    {
+        x[i] = v[0];
+        y[i] = v[1];
+        z[i] = v[2];
+        w[i] = v[3];
+    }
+
+    Vec4 get(const std::size_t i) const
+    {
+        return { x[i], y[i], z[i], w[i] };
+    }
+
+    // Transforms the first count vectors with m
+    void transform(const Mat44& m, const std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; i += LANES)
+        {
+            transformLanes(m, i);
+        }
+    }
+
+    alignas(32) std::array<float, N> x {};
+    alignas(32) std::array<float, N> y {};
+    alignas(32) std::array<float, N> z {};
+    alignas(32) std::array<float, N> w {};
+
+private:
+#if defined(__AVX__)
+    using Reg = __m256;
+    static Reg load(const float* p) { return _mm256_load_ps(p); }
+    static void store(float* p, const Reg r) { _mm256_store_ps(p, r); }
+    static Reg set1(const float v) { return _mm256_set1_ps(v); }
+    static Reg add(const Reg a, const Reg b) { return _mm256_add_ps(a, b); }
+    static Reg mul(const Reg a, const Reg b) { return _mm256_mul_ps(a, b); }
+#elif defined(__SSE2__) || defined(_M_X64)
+    using Reg = __m128;
+    static Reg load(const float* p) { return _mm_load_ps(p); }
+    static void store(float* p, const Reg r) { _mm_store_ps(p, r); }
+    static Reg set1(const float v) { return _mm_set1_ps(v); }
+    static Reg add(const Reg a, const Reg b) { return _mm_add_ps(a, b); }
+    static Reg mul(const Reg a, const Reg b) { return _mm_mul_ps(a, b); }
+#elif defined(__ARM_NEON)
+    using Reg = float32x4_t;
+    static Reg load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, const Reg r) { vst1q_f32(p, r); }
+    static Reg set1(const float v) { return vdupq_n_f32(v); }
+    static Reg add(const Reg a, const Reg b) { return vaddq_f32(a, b); }
+    static Reg mul(const Reg a, const Reg b) { return vmulq_f32(a, b); }
+#else
+    using Reg = float;
+    static Reg load(const float* p) { return *p; }
+    static void store(float* p, const Reg r) { *p = r; }
+    static Reg set1(const float v) { return v; }
+    static Reg add(const Reg a, const Reg b) { return a + b; }
+    static Reg mul(const Reg a, const Reg b) { return a * b; }
+#endif
+
+    void transformLanes(const Mat44& m, const std::size_t i)
+    {
+        const Reg sx = load(&x[i]);
+        const Reg sy = load(&y[i]);
+        const Reg sz = load(&z[i]);
+        const Reg sw = load(&w[i]);
+        const auto row = [&](const std::size_t j)
+        {
+            Reg r = mul(sx, set1(m[0][j]));
+            r = add(r, mul(sy, set1(m[1][j])));
+            r = add(r, mul(sz, set1(m[2][j])));
+            return add(r, mul(sw, set1(m[3][j])));
+        };
+        store(&x[i], row(0));
+        store(&y[i], row(1));
+        store(&z[i], row(2));
+        store(&w[i], row(3));
+    }
+};
+
+} // namespace rr
+#endif // VEC4SOA_HPP
@@ -62,6 +62,11 @@ public:
         return ret;
     }
 
+    void snapshotState(StateSnapshot& snapshot) const
+    {
+        snapshot.add(m_featureEnable.serialize());
+    }
+
 private:
     Renderer& m_renderer;
     Texture& m_texture;
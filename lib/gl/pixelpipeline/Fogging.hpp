@@ -45,6 +45,15 @@ public:
 
     bool updateFogLut();
 
+    void snapshotState(StateSnapshot& snapshot) const
+    {
+        snapshot.add(m_fogDirty);
+        snapshot.add(m_fogMode);
+        snapshot.add(m_fogStart);
+        snapshot.add(m_fogEnd);
+        snapshot.add(m_fogDensity);
+    }
+
 private:
     Renderer& m_renderer;
     bool m_fogDirty { false };
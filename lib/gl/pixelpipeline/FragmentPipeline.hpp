@@ -68,6 +68,11 @@ public:
         return ret;
     }
 
+    void snapshotState(StateSnapshot& snapshot) const
+    {
+        snapshot.add(m_fragmentPipelineConf.serialize());
+    }
+
 private:
     FragmentPipelineReg& config() { return m_fragmentPipelineConf; }
     const FragmentPipelineReg& config() const { return m_fragmentPipelineConf; }
@@ -37,8 +37,12 @@ public:
 
     // Drawing
     bool drawTriangle(const TransformedTriangle& triangle) { return m_renderer.drawTriangle(triangle); }
-    void setVertexContext(const vertextransforming::VertexTransformingData& ctx) { m_renderer.setVertexContext(ctx); }
+    void setVertexContext(const vertextransforming::VertexTransformingData& ctx, const vertextransforming::VertexTransformingData::DirtyBits dirty)
+    {
+        m_renderer.setVertexContext(ctx, dirty);
+    }
     bool pushVertex(const VertexParameter& vertex) { return m_renderer.pushVertex(vertex); }
+    bool pushVertices(const tcb::span<const VertexParameter> vertices, const tcb::span<const VertexCacheTag> tags = {}) { return m_renderer.pushVertices(vertices, tags); }
 
     // Switch and updating of display lists
     void swapDisplayList() { m_renderer.swapDisplayList(); }
@@ -51,6 +55,11 @@ public:
         return m_renderer.setScissorBox(x, y, width, height);
     }
     void enableVSync(const bool enable) { m_renderer.setEnableVSync(enable); }
+    bool setDisplayListAssemblyWorkers(tcb::span<IThreadRunner* const> workers) { return m_renderer.setDisplayListAssemblyWorkers(workers); }
+    std::size_t setMaxFramesInFlight(const std::size_t frames) { return m_renderer.setMaxFramesInFlight(frames); }
+    bool setDrawReordering(const bool enable) { return m_renderer.setDrawReordering(enable); }
+    void waitTillUploaded() { m_renderer.waitTillUploaded(); }
+    std::size_t getAvoidedTextureStreams() const { return m_renderer.getAvoidedTextureStreams(); }
 
     // Framebuffer
     bool clearFramebuffer(const bool frameBuffer, const bool zBuffer, const bool stencilBuffer);
@@ -67,6 +76,16 @@ public:
     bool updatePipeline();
     bool setStencilBufferConfig(const StencilReg& stencilConf) { return m_renderer.setStencilBufferConfig(stencilConf); }
 
+    // Adds the state of the pixel pipeline to the snapshot
+    void snapshotState(StateSnapshot& snapshot) const
+    {
+        m_fog.snapshotState(snapshot);
+        m_texture.snapshotState(snapshot);
+        m_fragmentPipeline.snapshotState(snapshot);
+        m_featureEnable.snapshotState(snapshot);
+        m_renderer.snapshotState(snapshot);
+    }
+
 private:
     Renderer m_renderer;
 
@@ -82,6 +82,17 @@ public:
     void activateTmu(const std::size_t tmu);
     std::size_t getActiveTmu() const { return m_tmu; }
 
+    void snapshotState(StateSnapshot& snapshot) const
+    {
+        for (const TmuConfig& tmuConf : m_tmuConf)
+        {
+            snapshot.add(tmuConf.boundTexture);
+            snapshot.add(tmuConf.texEnvMode);
+            snapshot.add(tmuConf.texEnvConf.serialize());
+        }
+        snapshot.add(m_tmu);
+    }
+
 private:
     struct TmuConfig
     {
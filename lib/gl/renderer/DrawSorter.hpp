@@ -0,0 +1,324 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef DRAWSORTER_HPP
+#define DRAWSORTER_HPP
+
+#include "StateSnapshot.hpp"
+#include "registers/ColorBufferAddrReg.hpp"
+#include "registers/FeatureEnableReg.hpp"
+#include "registers/FragmentPipelineReg.hpp"
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <numeric>
+#include <stdint.h>
+#include <vector>
+
+namespace rr
+{
+
+// Records the triangles of a frame together with the state they are using and emits them sorted by their
+// textures and register values. This reduces the number of texture streams and register writes when an
+// application switches between a few textures.
+// The triangles are grouped into draws. A draw is a run of triangles which are using the same state.
+// Only opaque draws (depth test and depth mask enabled, no blending, no stencil test, all color channels
+// written) are reordered, because the depth test makes their result independent of the order. All other draws
+// keep their position and separate the opaque runs. Fragments with exactly the same depth might be resolved
+// differently than in the submission order.
+template <typename RenderConfig, typename TTriangleCmd>
+class DrawSorter
+{
+public:
+    static constexpr std::size_t REGISTER_COUNT { 32 };
+    static constexpr uint32_t NO_TEXTURE { 0xffff'ffff };
+
+    // Register with an address known at runtime. Used to write the recorded register values.
+    class RegisterValue
+    {
+    public:
+        RegisterValue(const uint32_t addr, const uint32_t value)
+            : m_addr { addr }
+            , m_value { value }
+        {
+        }
+
+        uint32_t serialize() const { return m_value; }
+        uint32_t getAddr() const { return m_addr; }
+
+    private:
+        uint32_t m_addr {};
+        uint32_t m_value {};
+    };
+
+    // Enables the recording. The buffers are only allocated while the recording is enabled.
+    // The recorded draws must be flushed before it is disabled.
+    void setEnable(const bool enable)
+    {
+        m_enabled = enable;
+        m_draws.clear();
+        m_triangles.clear();
+        m_recordedTextureStreams = 0;
+        m_emittedTextureStreams = 0;
+        if (enable)
+        {
+            m_draws.reserve(RenderConfig::DRAW_SORTER_MAX_DRAWS);
+            m_triangles.reserve(RenderConfig::DRAW_SORTER_MAX_TRIANGLES);
+            m_order.reserve(RenderConfig::DRAW_SORTER_MAX_DRAWS);
+            // Up to now every state was directly written, therefore the current state is also the emitted one
+            m_emitted = m_current;
+        }
+        else
+        {
+            m_draws = {};
+            m_triangles = {};
+            m_order = {};
+        }
+    }
+
+    bool isEnabled() const { return m_enabled; }
+
+    // Tracks a register write. The state is also tracked when the sorter is disabled, to know the
+    // current state when it is enabled. Returns false if the register can't be tracked.
+    bool writeRegister(const uint32_t addr, const uint32_t value)
+    {
+        if (addr >= REGISTER_COUNT)
+        {
+            return false;
+        }
+        m_current.registers[addr] = value;
+        m_current.valid.set(addr);
+        m_stateChanged = true;
+        return true;
+    }
+
+    // Tracks the texture which is bound to a TMU
+    void useTexture(const std::size_t tmu, const uint16_t texId)
+    {
+        m_current.textures[tmu] = texId;
+        m_stateChanged = true;
+        if (m_enabled)
+        {
+            m_recordedTextureStreams++;
+        }
+    }
+
+    // Adds a triangle with the current state. Returns false when the buffers are full and must be flushed.
+    bool addTriangle(const TTriangleCmd& triangle)
+    {
+        if (m_triangles.size() >= RenderConfig::DRAW_SORTER_MAX_TRIANGLES)
+        {
+            return false;
+        }
+        if (m_draws.empty() || (m_stateChanged && (m_draws.back().state != m_current)))
+        {
+            if (m_draws.size() >= RenderConfig::DRAW_SORTER_MAX_DRAWS)
+            {
+                return false;
+            }
+            m_draws.push_back({ m_current, static_cast<uint32_t>(m_triangles.size()), 0 });
+        }
+        m_stateChanged = false;
+        m_triangles.push_back(triangle);
+        m_draws.back().count++;
+        return true;
+    }
+
+    // Emits the recorded draws in sorted order, followed by the current state.
+    // regFunc: bool(const RegisterValue&), textureFunc: bool(std::size_t tmu, uint16_t texId),
+    // triangleFunc: bool(TTriangleCmd&)
+    template <typename TRegFunc, typename TTextureFunc, typename TTriangleFunc>
+    bool flush(const TRegFunc& regFunc, const TTextureFunc& textureFunc, const TTriangleFunc& triangleFunc)
+    {
+        sortDraws();
+        bool ret = true;
+        for (const uint32_t i : m_order)
+        {
+            const Draw& draw = m_draws[i];
+            ret = emitState(draw.state, regFunc, textureFunc) && ret;
+            for (uint32_t j = draw.first; j < (draw.first + draw.count); j++)
+            {
+                ret = triangleFunc(m_triangles[j]) && ret;
+            }
+        }
+        // The commands following the flush expect the state in submission order
+        ret = emitState(m_current, regFunc, textureFunc) && ret;
+
+        if (m_recordedTextureStreams > m_emittedTextureStreams)
+        {
+            m_avoidedTextureStreams += m_recordedTextureStreams - m_emittedTextureStreams;
+        }
+        m_recordedTextureStreams = 0;
+        m_emittedTextureStreams = 0;
+        m_draws.clear();
+        m_triangles.clear();
+        m_stateChanged = true;
+        return ret;
+    }
+
+    // Forces a write of all registers with the next flush. Required when registers were written
+    // without the sorter.
+    void invalidateRegisters() { m_emitted.valid.reset(); }
+
+    // Forces a stream of all textures with the next flush. Required when the texture pages have changed.
+    void invalidateTextures() { m_emitted.textures.fill(NO_TEXTURE); }
+
+    std::size_t getAvoidedTextureStreams() const { return m_avoidedTextureStreams; }
+
+    // Adds the tracked registers and textures. The color buffer address is left out, it alternates with every
+    // swap of the framebuffers.
+    void snapshotState(StateSnapshot& snapshot) const
+    {
+        DrawState state = m_current;
+        state.registers[ColorBufferAddrReg::getAddr()] = 0;
+        state.valid.reset(ColorBufferAddrReg::getAddr());
+        snapshot.add(state.registers.data(), state.registers.size());
+        snapshot.add(state.valid.to_ulong());
+        snapshot.add(state.textures.data(), state.textures.size());
+    }
+
+private:
+    struct DrawState
+    {
+        std::array<uint32_t, REGISTER_COUNT> registers {};
+        std::bitset<REGISTER_COUNT> valid {};
+        std::array<uint32_t, RenderConfig::TMU_COUNT> textures { makeNoTextures() };
+
+        bool operator==(const DrawState& rhs) const
+        {
+            return (textures == rhs.textures) && (valid == rhs.valid) && (registers == rhs.registers);
+        }
+        bool operator!=(const DrawState& rhs) const { return !operator==(rhs); }
+        bool operator<(const DrawState& rhs) const
+        {
+            if (textures != rhs.textures)
+            {
+                return textures < rhs.textures;
+            }
+            return registers < rhs.registers;
+        }
+    };
+
+    struct Draw
+    {
+        DrawState state;
+        uint32_t first;
+        uint32_t count;
+    };
+
+    static constexpr std::array<uint32_t, RenderConfig::TMU_COUNT> makeNoTextures()
+    {
+        std::array<uint32_t, RenderConfig::TMU_COUNT> textures {};
+        for (uint32_t& t : textures)
+        {
+            t = NO_TEXTURE;
+        }
+        return textures;
+    }
+
+    static bool isOpaque(const DrawState& state)
+    {
+        if (!state.valid[FeatureEnableReg::getAddr()] || !state.valid[FragmentPipelineReg::getAddr()])
+        {
+            return false;
+        }
+        FeatureEnableReg features;
+        features.deserialize(state.registers[FeatureEnableReg::getAddr()]);
+        FragmentPipelineReg pipeline;
+        pipeline.deserialize(state.registers[FragmentPipelineReg::getAddr()]);
+        const TestFunc depthFunc = pipeline.getDepthFunc();
+        return features.getEnableDepthTest()
+            && !features.getEnableBlending()
+            && !features.getEnableStencilTest()
+            && pipeline.getDepthMask()
+            && pipeline.getColorMaskR() && pipeline.getColorMaskG() && pipeline.getColorMaskB() && pipeline.getColorMaskA()
+            && ((depthFunc == TestFunc::LESS) || (depthFunc == TestFunc::LEQUAL) || (depthFunc == TestFunc::GREATER) || (depthFunc == TestFunc::GEQUAL));
+    }
+
+    static uint32_t getDepthFunc(const DrawState& state)
+    {
+        FragmentPipelineReg pipeline;
+        pipeline.deserialize(state.registers[FragmentPipelineReg::getAddr()]);
+        return static_cast<uint32_t>(pipeline.getDepthFunc());
+    }
+
+    void sortDraws()
+    {
+        m_order.resize(m_draws.size());
+        std::iota(m_order.begin(), m_order.end(), 0);
+        std::size_t start = 0;
+        while (start < m_draws.size())
+        {
+            if (!isOpaque(m_draws[start].state))
+            {
+                start++;
+                continue;
+            }
+            // A run of opaque draws with the same depth function can be sorted
+            const uint32_t depthFunc = getDepthFunc(m_draws[start].state);
+            std::size_t end = start + 1;
+            while ((end < m_draws.size()) && isOpaque(m_draws[end].state) && (getDepthFunc(m_draws[end].state) == depthFunc))
+            {
+                end++;
+            }
+            std::stable_sort(m_order.begin() + start, m_order.begin() + end,
+                [this](const uint32_t a, const uint32_t b)
+                { return m_draws[a].state < m_draws[b].state; });
+            start = end;
+        }
+    }
+
+    template <typename TRegFunc, typename TTextureFunc>
+    bool emitState(const DrawState& state, const TRegFunc& regFunc, const TTextureFunc& textureFunc)
+    {
+        bool ret = true;
+        for (std::size_t tmu = 0; tmu < RenderConfig::TMU_COUNT; tmu++)
+        {
+            if ((state.textures[tmu] != NO_TEXTURE) && (state.textures[tmu] != m_emitted.textures[tmu]))
+            {
+                ret = textureFunc(tmu, static_cast<uint16_t>(state.textures[tmu])) && ret;
+                m_emitted.textures[tmu] = state.textures[tmu];
+                m_emittedTextureStreams++;
+            }
+        }
+        for (uint32_t addr = 0; addr < REGISTER_COUNT; addr++)
+        {
+            if (state.valid[addr] && (!m_emitted.valid[addr] || (m_emitted.registers[addr] != state.registers[addr])))
+            {
+                ret = regFunc(RegisterValue { addr, state.registers[addr] }) && ret;
+                m_emitted.registers[addr] = state.registers[addr];
+                m_emitted.valid.set(addr);
+            }
+        }
+        return ret;
+    }
+
+    bool m_enabled { false };
+    bool m_stateChanged { true };
+    DrawState m_current {};
+    DrawState m_emitted {};
+    std::vector<Draw> m_draws {};
+    std::vector<TTriangleCmd> m_triangles {};
+    std::vector<uint32_t> m_order {};
+
+    std::size_t m_recordedTextureStreams { 0 };
+    std::size_t m_emittedTextureStreams { 0 };
+    std::size_t m_avoidedTextureStreams { 0 };
+};
+
+} // namespace rr
+#endif // DRAWSORTER_HPP
@@ -18,6 +18,7 @@
 #ifndef _IDEVICE_HPP_
 #define _IDEVICE_HPP_
 
+#include <chrono>
 #include <cstdint>
 #include <tcb/span.hpp>
 
@@ -31,6 +32,11 @@ public:
     virtual void streamDisplayList(const uint8_t index, const uint32_t size) = 0;
     virtual void writeToDeviceMemory(tcb::span<const uint8_t> data, const uint32_t addr) = 0;
     virtual bool clearToSend() = 0;
+    // Waits till the device is clear to send. Returns false when the timeout elapsed.
+    virtual bool waitClearToSend(const std::chrono::milliseconds timeout) = 0;
+    // Waits till the device has processed all streamed display lists and their buffers can be written again.
+    // Only required for devices which process the display lists asynchronously to streamDisplayList().
+    virtual void waitTillIdle() { }
     virtual tcb::span<uint8_t> requestDisplayListBuffer(const uint8_t index) = 0;
     virtual uint8_t getDisplayListBufferCount() const = 0;
 };
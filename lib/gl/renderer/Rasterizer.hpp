@@ -78,7 +78,7 @@ private:
     int32_t m_scissorEndX { 0 };
     int32_t m_scissorEndY { 0 };
     bool m_enableScissor { false };
-    const bool m_enableScaling { false };
+    bool m_enableScaling { false };
     std::bitset<RenderConfig::TMU_COUNT> m_tmuEnable {};
 };
 
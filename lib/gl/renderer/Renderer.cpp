@@ -22,9 +22,10 @@ Renderer::Renderer(IDevice& device, IThreadRunner& runner)
     : m_device { device }
     , m_displayListUploaderThread { runner }
 {
-    m_displayListBuffer.getBack().clearDisplayListAssembler();
-    m_displayListBuffer.getFront().clearDisplayListAssembler();
-
+    for (DisplayListDispatcherType& dispatcher : m_displayListDispatcher)
+    {
+        dispatcher.setStateLogs(&m_stateLog, m_workerStateLogs);
+    }
     initDisplayLists();
 
     setYOffset();
@@ -47,12 +48,14 @@ Renderer::Renderer(IDevice& device, IThreadRunner& runner)
 
 Renderer::~Renderer()
 {
+    setDrawReordering(false);
+    setDisplayListAssemblyWorkers({});
     clearDisplayListAssembler();
     setColorBufferAddress(RenderConfig::COLOR_BUFFER_LOC_0);
     swapScreenToNewColorBuffer();
     switchDisplayLists();
     uploadDisplayList();
-    m_displayListUploaderThread.wait();
+    waitTillUploaded();
 }
 
 bool Renderer::drawTriangle(const TransformedTriangle& triangle)
@@ -69,7 +72,7 @@ bool Renderer::drawTriangle(const TransformedTriangle& triangle)
     }
 }
 
-void Renderer::setVertexContext(const vertextransforming::VertexTransformingData& ctx)
+void Renderer::setVertexContext(const vertextransforming::VertexTransformingData& ctx, const vertextransforming::VertexTransformingData::DirtyBits dirty)
 {
     if constexpr (!RenderConfig::THREADED_RASTERIZATION || (RenderConfig::getDisplayLines() > 1))
     {
@@ -82,21 +85,66 @@ void Renderer::setVertexContext(const vertextransforming::VertexTransformingData
 
     if constexpr (RenderConfig::THREADED_RASTERIZATION && (RenderConfig::getDisplayLines() == 1))
     {
-        if (!addCommand(SetVertexCtxCmd { ctx }))
+        const vertextransforming::VertexTransformingData::DirtyBits blocks = m_vertexCtxLost
+            ? vertextransforming::VertexTransformingData::DirtyBits {}.set()
+            : dirty;
+        m_vertexCtxLost = !addCommand(SetVertexCtxCmd { ctx, blocks });
+        if (m_vertexCtxLost)
         {
             SPDLOG_CRITICAL("Cannot push vertex context into queue. This may brake the rendering.");
         }
+        m_vertexAttributes = PushVertexBatchCmd::getAttributeMask(ctx);
+    }
+}
+
+bool Renderer::pushVertices(const tcb::span<const VertexParameter> vertices, const tcb::span<const VertexCacheTag> tags)
+{
+    if constexpr (RenderConfig::THREADED_RASTERIZATION && (RenderConfig::getDisplayLines() == 1))
+    {
+        bool ret = true;
+        const std::size_t count = tags.empty() ? vertices.size() : tags.size();
+        std::size_t vertexPos = 0;
+        for (std::size_t i = 0; i < count; i += RenderConfig::THREADED_RASTERIZATION_VERTEX_BATCH_SIZE)
+        {
+            const std::size_t batchSize = (std::min)(RenderConfig::THREADED_RASTERIZATION_VERTEX_BATCH_SIZE, count - i);
+            const tcb::span<const VertexCacheTag> batchTags = tags.empty() ? tags : tags.subspan(i, batchSize);
+            if (!addCommand(PushVertexBatchCmd { vertices.subspan(vertexPos), batchTags, m_vertexAttributes }))
+            {
+                SPDLOG_CRITICAL("Cannot push vertices into queue. This may brake the rendering.");
+                ret = false;
+            }
+            vertexPos += tags.empty() ? batchSize : VertexCacheTag::getVertexCount(batchTags);
+        }
+        return ret;
+    }
+    else
+    {
+        return m_vertexTransform.pushVertices(vertices, tags);
     }
 }
 
 void Renderer::initDisplayLists()
 {
-    for (std::size_t i = 0, buffId = 0; i < m_displayListAssembler[0].size(); i++)
+    // Use as many display list sets as the device has buffers for. The remaining buffers
+    // are distributed over the sets as overflow segments.
+    const std::size_t lines = RenderConfig::getDisplayLines();
+    const std::size_t bufferCount = m_device.getDisplayListBufferCount();
+    m_displayListBuffer.setDepth(bufferCount / lines);
+    const std::size_t depth = m_displayListBuffer.getDepth();
+    const std::size_t segments = (std::min)(DISPLAY_LIST_OVERFLOW_SEGMENTS, (bufferCount - (std::min)(bufferCount, depth * lines)) / depth);
+    std::size_t buffId = 0;
+    for (std::size_t i = 0; i < (lines + segments); i++)
     {
-        m_displayListAssembler[0][i].setBuffer(m_device.requestDisplayListBuffer(buffId), buffId);
-        buffId++;
-        m_displayListAssembler[1][i].setBuffer(m_device.requestDisplayListBuffer(buffId), buffId);
-        buffId++;
+        for (std::size_t j = 0; j < depth; j++)
+        {
+            m_displayListAssembler[j][i].setBuffer(m_device.requestDisplayListBuffer(buffId), buffId);
+            buffId++;
+        }
+    }
+    for (std::size_t j = 0; j < depth; j++)
+    {
+        m_displayListBuffer.get(j).setOverflowSegments(segments);
+        m_displayListBuffer.get(j).clearDisplayListAssembler();
     }
 }
 
@@ -106,23 +154,26 @@ void Renderer::intermediateUpload()
     // is not supported which is a requirement to get it to work.
     if (m_displayListBuffer.getBack().singleList())
     {
+        DisplayListDispatcherType& previous = m_displayListBuffer.getBack();
         switchDisplayLists();
-        uploadTextures();
         clearDisplayListAssembler();
+        m_displayListBuffer.getBack().takeOverTrailingStateCommands(previous);
         uploadDisplayList();
     }
 }
 
 void Renderer::swapDisplayList()
 {
+    flushDraws();
     addLineColorBufferAddresses();
     addCommitFramebufferCommand();
     addColorBufferAddressOfTheScreen();
     swapScreenToNewColorBuffer();
     switchDisplayLists();
-    uploadTextures();
     clearDisplayListAssembler();
     setYOffset();
+    // The color buffer address was written without the sorter
+    m_drawSorter.invalidateRegisters();
     swapFramebuffer();
 }
 
@@ -187,29 +238,53 @@ void Renderer::setYOffset()
 
 void Renderer::uploadDisplayList()
 {
+    // Uploads all queued frames and returns when the queue is empty.
+    // The textures of a frame are uploaded right before the first display list which is using them, so the texture
+    // uploads are interleaved with the display lists. The frames are uploaded in order, therefore the pages of a
+    // frame are never overwritten while a previous frame is still using them.
     const std::function<bool()> uploader = [this]()
     {
-        return m_displayListBuffer.getFront().displayListLooper(
-            [this](
-                DisplayListDispatcherType& dispatcher,
-                const std::size_t i,
-                const std::size_t,
-                const std::size_t,
-                const std::size_t)
-            {
-                while (!m_device.clearToSend())
-                    ;
-                m_device.streamDisplayList(
-                    dispatcher.getDisplayListBufferId(i),
-                    dispatcher.getDisplayListSize(i));
-                return true;
-            });
+        const TextureManagerType::UploadQueue::Uploader textureUploader = [this](uint32_t gramAddr, const tcb::span<const uint8_t> data)
+        {
+            waitTillDeviceIsClearToSend();
+            m_device.writeToDeviceMemory(data, gramAddr);
+            return true;
+        };
+        do
+        {
+            TextureManagerType::UploadQueue& textures = m_textureUploads[m_displayListBuffer.getFrontIndex()];
+            m_displayListBuffer.getFront().displayListLooper(
+                [this, &textures, &textureUploader](
+                    DisplayListDispatcherType& dispatcher,
+                    const std::size_t i,
+                    const std::size_t,
+                    const std::size_t,
+                    const std::size_t)
+                {
+                    textures.upload(dispatcher.getTexturePages(i), textureUploader);
+                    return dispatcher.displayListSegmentLooper(i,
+                        [this](const std::size_t bufferId, const std::size_t size)
+                        {
+                            waitTillDeviceIsClearToSend();
+                            m_device.streamDisplayList(bufferId, size);
+                            return true;
+                        });
+                });
+            textures.uploadAll(textureUploader);
+            // The set must not be written again while the device is still reading it
+            m_device.waitTillIdle();
+        } while (m_displayListBuffer.release());
+        return true;
     };
-    m_displayListUploaderThread.run(uploader);
+    if (m_displayListBuffer.publish())
+    {
+        m_displayListUploaderThread.run(uploader);
+    }
 }
 
 bool Renderer::clear(const bool colorBuffer, const bool depthBuffer, const bool stencilBuffer)
 {
+    flushDraws();
     return addCommandWithFactory_if(
         [&](const std::size_t, const std::size_t, const std::size_t x, const std::size_t y)
         {
@@ -247,16 +322,34 @@ bool Renderer::useTexture(const std::size_t tmu, const uint16_t texId)
     }
     bool ret { true };
 
-    const tcb::span<const std::size_t> pages = m_textureManager.getPages(texId);
-    ret = ret && addCommand(TextureStreamCmd { tmu, pages });
+    m_drawSorter.useTexture(tmu, texId);
+    if (!m_drawSorter.isEnabled())
+    {
+        ret = ret && streamTexture(tmu, texId);
+    }
 
     TmuTextureReg reg = m_textureManager.getTmuConfig(texId);
     reg.setTmu(tmu);
-    ret = ret && addCommand(WriteRegisterCmd { reg });
+    ret = ret && writeReg(reg);
 
     return ret;
 }
 
+bool Renderer::updateTexture(const uint16_t texId, const TextureObjectMipmap& textureObject)
+{
+    // The recorded draws are using the pages of the texture
+    flushDraws();
+    m_drawSorter.invalidateTextures();
+    return m_textureManager.updateTexture(texId, textureObject);
+}
+
+bool Renderer::deleteTexture(const uint16_t texId)
+{
+    flushDraws();
+    m_drawSorter.invalidateTextures();
+    return m_textureManager.deleteTexture(texId);
+}
+
 bool Renderer::setFeatureEnableConfig(const FeatureEnableReg& featureEnable)
 {
     m_scissorEnabled = featureEnable.getEnableScissor();
@@ -316,11 +409,15 @@ bool Renderer::enableTextureMinFiltering(const std::size_t tmu, const uint16_t t
 
 bool Renderer::setRenderResolution(const std::size_t x, const std::size_t y)
 {
-    // The resolution must be set on both displaylists
-    if (!m_displayListBuffer.getBack().setResolution(x, y)
-        || !m_displayListBuffer.getFront().setResolution(x, y))
+    // The recorded triangles must be added with the old resolution
+    flushDraws();
+    // The resolution must be set on all displaylists
+    for (std::size_t i = 0; i < m_displayListBuffer.getDepth(); i++)
     {
-        return false;
+        if (!m_displayListBuffer.get(i).setResolution(x, y))
+        {
+            return false;
+        }
     }
 
     RenderResolutionReg reg;
@@ -335,23 +432,111 @@ bool Renderer::writeToTextureConfig(const std::size_t tmu, const uint16_t texId,
     return writeReg(tmuConfig);
 }
 
+bool Renderer::streamTexture(const std::size_t tmu, const uint16_t texId)
+{
+    TmuResidency& resident = m_tmuResidency[tmu];
+    const uint32_t generation = m_textureManager.getGeneration(texId);
+    if (resident.valid && (resident.texId == texId) && (resident.generation == generation))
+    {
+        return true;
+    }
+    const tcb::span<const std::size_t> pages = m_textureManager.getPages(texId);
+    resident.valid = addCommand(TextureStreamCmd { tmu, pages });
+    resident.texId = texId;
+    resident.generation = generation;
+    return resident.valid;
+}
+
 bool Renderer::setColorBufferAddress(const uint32_t addr)
 {
     m_colorBufferAddr = addr;
     return writeReg(ColorBufferAddrReg { addr });
 }
 
-void Renderer::uploadTextures()
+bool Renderer::setDisplayListAssemblyWorkers(tcb::span<IThreadRunner* const> workers)
 {
+    if (workers.size() > RenderConfig::DISPLAY_LIST_ASSEMBLY_MAX_WORKERS)
+    {
+        SPDLOG_ERROR("setDisplayListAssemblyWorkers(): Too many workers ({})", workers.size());
+        return false;
+    }
+    if (DisplayListDispatcherType::singleList())
+    {
+        return true;
+    }
+
+    for (DisplayListDispatcherType& dispatcher : m_displayListDispatcher)
+    {
+        dispatcher.finishParallelAssembly();
+    }
+    std::copy(workers.begin(), workers.end(), m_displayListAssemblyWorkers.begin());
+    const tcb::span<IThreadRunner* const> activeWorkers { m_displayListAssemblyWorkers.data(), workers.size() };
+    for (DisplayListDispatcherType& dispatcher : m_displayListDispatcher)
+    {
+        dispatcher.setParallelAssemblyWorkers(&m_commandQueue, activeWorkers);
+    }
+    if (workers.empty())
+    {
+        m_commandQueueBuffer = {};
+        return true;
+    }
+    m_commandQueueBuffer.resize(RenderConfig::DISPLAY_LIST_ASSEMBLY_QUEUE_SIZE);
+    m_commandQueue.setBuffer(m_commandQueueBuffer);
+    m_displayListBuffer.getBack().startParallelAssembly();
+    return true;
+}
+
+void Renderer::waitTillUploaded()
+{
+    m_displayListBuffer.waitTillIdle();
     m_displayListUploaderThread.wait();
-    m_textureManager.uploadTextures(
-        [&](uint32_t gramAddr, const tcb::span<const uint8_t> data)
+}
+
+std::size_t Renderer::setMaxFramesInFlight(const std::size_t frames)
+{
+    m_displayListBuffer.setMaxFramesInFlight(frames);
+    return m_displayListBuffer.getMaxFramesInFlight();
+}
+
+bool Renderer::setDrawReordering(const bool enable)
+{
+    if constexpr (RenderConfig::THREADED_RASTERIZATION && (RenderConfig::getDisplayLines() == 1))
+    {
+        // The triangles are created by the threaded rasterizer
+        return !enable;
+    }
+    flushDraws();
+    m_drawSorter.setEnable(enable);
+    return true;
+}
+
+bool Renderer::flushDraws()
+{
+    if (!m_drawSorter.isEnabled())
+    {
+        return true;
+    }
+    return m_drawSorter.flush(
+        [this](const DrawSorterType::RegisterValue& reg)
+        { return addCommand(WriteRegisterCmd { reg }); },
+        [this](const std::size_t tmu, const uint16_t texId)
         {
-            while (!m_device.clearToSend())
-                ;
-            m_device.writeToDeviceMemory(data, gramAddr);
-            return true;
-        });
+            if (!m_textureManager.textureValid(texId))
+            {
+                return true;
+            }
+            return streamTexture(tmu, texId);
+        },
+        [this](TriangleCmdType& triangleCmd)
+        { return addTriangleCmdToDisplayList(triangleCmd); });
+}
+
+void Renderer::waitTillDeviceIsClearToSend()
+{
+    while (!m_device.waitClearToSend(std::chrono::milliseconds { RenderConfig::DEVICE_CLEAR_TO_SEND_TIMEOUT_MS }))
+    {
+        SPDLOG_WARN("Device is not clear to send after {} ms", RenderConfig::DEVICE_CLEAR_TO_SEND_TIMEOUT_MS);
+    }
 }
 
 void Renderer::swapFramebuffer()
@@ -20,12 +20,13 @@
 
 #include "IThreadRunner.hpp"
 #include "Rasterizer.hpp"
+#include "DrawSorter.hpp"
 #include "Renderer.hpp"
 #include "TextureMemoryManager.hpp"
 #include "displaylist/DisplayList.hpp"
 #include "displaylist/DisplayListAssembler.hpp"
 #include "displaylist/DisplayListDispatcher.hpp"
-#include "displaylist/DisplayListDoubleBuffer.hpp"
+#include "displaylist/DisplayListRing.hpp"
 #include "math/Vec.hpp"
 #include "renderer/IDevice.hpp"
 #include <algorithm>
@@ -34,11 +35,16 @@
 #include <optional>
 #include <stdint.h>
 #include <string.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "RenderConfigs.hpp"
+#include "StateSnapshot.hpp"
 #include "commands/FogLutStreamCmd.hpp"
 #include "commands/FramebufferCmd.hpp"
 #include "commands/NopCmd.hpp"
+#include "commands/PushVertexBatchCmd.hpp"
 #include "commands/PushVertexCmd.hpp"
 #include "commands/RegularTriangleCmd.hpp"
 #include "commands/SetVertexCtxCmd.hpp"
@@ -80,13 +86,23 @@ public:
 
     /// @brief Sets a new vertex context
     /// @param ctx The vertex context with transformation matrices, light configs and others.
-    void setVertexContext(const vertextransforming::VertexTransformingData& ctx);
+    /// @param dirty The blocks of the context which have changed since the last call. With the threaded
+    ///     rasterization, only these blocks are transferred.
+    void setVertexContext(const vertextransforming::VertexTransformingData& ctx, const vertextransforming::VertexTransformingData::DirtyBits dirty);
 
     /// @brief Pushes a vertex into the renderer
     /// @param vertex The new vertex
     /// @return true when the vertex was accepted. False could be a out of memory error.
     bool pushVertex(const VertexParameter& vertex) { return pushVertexImpl(vertex); }
 
+    /// @brief Pushes several vertices into the renderer. With the threaded rasterization, the vertices are
+    /// transferred in batches which only contain the attributes used by the current vertex context.
+    /// @param vertices The new vertices
+    /// @param tags Optional tags of the vertices for the post transform vertex cache, one per vertex.
+    ///     The vertices tagged with REUSE have no entry in vertices.
+    /// @return true when the vertices were accepted. False could be a out of memory error.
+    bool pushVertices(const tcb::span<const VertexParameter> vertices, const tcb::span<const VertexCacheTag> tags = {});
+
     /// @brief Starts the rendering process by uploading textures and the displaylist and also swapping
     /// the framebuffers
     void swapDisplayList();
@@ -94,6 +110,9 @@ public:
     /// @brief Uploads the display list to the hardware
     void uploadDisplayList();
 
+    /// @brief Waits till all queued display lists are uploaded to the hardware
+    void waitTillUploaded();
+
     /// @brief Creates a new texture
     /// @return pair with the first value to indicate if the operation succeeded (true) and the second value with the id
     std::pair<bool, uint16_t> createTexture() { return m_textureManager.createTexture(); }
@@ -107,7 +126,7 @@ public:
     /// @param texId The texture id which texture has to be updated
     /// @param textureObject The object which contains the texture and all its meta data
     /// @return true if succeeded, false if it was not possible to apply this command (for instance, displaylist was out if memory)
-    bool updateTexture(const uint16_t texId, const TextureObjectMipmap& textureObject) { return m_textureManager.updateTexture(texId, textureObject); }
+    bool updateTexture(const uint16_t texId, const TextureObjectMipmap& textureObject);
 
     /// @brief Returns a texture associated to the texId
     /// @param texId The texture id of the texture to get the data from
@@ -128,7 +147,17 @@ public:
     /// @brief Deletes a texture
     /// @param texId The id of the texture to delete
     /// @return true if succeeded
-    bool deleteTexture(const uint16_t texId) { return m_textureManager.deleteTexture(texId); }
+    bool deleteTexture(const uint16_t texId);
+
+    /// @brief Adds the current register values, the used textures and the scissor box to a snapshot
+    /// @param snapshot The snapshot of the GL state
+    void snapshotState(StateSnapshot& snapshot) const
+    {
+        m_drawSorter.snapshotState(snapshot);
+        snapshot.add(m_scissorEnabled);
+        snapshot.add(m_scissorYStart);
+        snapshot.add(m_scissorYEnd);
+    }
 
     /// @brief The wrapping mode of the texture in s direction
     /// @param tmu The used TMU
@@ -180,7 +209,11 @@ public:
     /// @param start the start value of the fog
     /// @param end the end value of the fog
     /// @return true if succeeded, false if it was not possible to apply this command (for instance, displaylist was out if memory)
-    bool setFogLut(const std::array<float, 33>& fogLut, float start, float end) { return addCommand(FogLutStreamCmd { fogLut, start, end }); }
+    bool setFogLut(const std::array<float, 33>& fogLut, float start, float end)
+    {
+        const bool ret = flushDraws();
+        return addCommand(FogLutStreamCmd { fogLut, start, end }) && ret;
+    }
 
     /// @brief Will clear a buffer
     /// @param frameBuffer Will clear the frame buffer
@@ -235,16 +268,68 @@ public:
     /// @return true if succeeded, false if it was not possible to apply this command (for instance, displaylist was out if memory)
     bool setFeatureEnableConfig(const FeatureEnableReg& featureEnable);
 
+    /// @brief Queries how many triangle inserts into display lists were saved by binning the triangles
+    ///     directly into the display lists they are covering
+    /// @return The number of saved display list inserts
+    std::size_t getSkippedDisplayListInserts() const
+    {
+        std::size_t skipped = 0;
+        for (const DisplayListDispatcherType& dispatcher : m_displayListDispatcher)
+        {
+            skipped += dispatcher.getSkippedDisplayListInserts();
+        }
+        return skipped;
+    }
+
+    /// @brief Enables the parallel assembly of the display lists. The triangles and commands are queued once
+    ///     into a shared queue and every worker fills a subset of the display lists. The order of the commands
+    ///     within a display list is preserved. Only has an effect when the screen is split into several display lists.
+    /// @param workers The runners used as workers. The runners must execute the operation concurrently to the
+    ///     calling thread (a SingleThreadRunner will deadlock). An empty span disables the parallel assembly.
+    /// @return true if succeeded, false if the number of workers is not supported
+    bool setDisplayListAssemblyWorkers(tcb::span<IThreadRunner* const> workers);
+
+    /// @brief Sets how many frames can be queued for the upload while the next frame is recorded. A higher number
+    ///     absorbs jitter in the upload time but increases the latency. swapDisplayList() blocks when the limit is reached.
+    ///     The default is one frame (double buffering). Every further frame adds one frame of latency.
+    /// @param frames Number of queued frames. It is limited by the display list sets which fit into the device
+    ///     (at most RenderConfig::DISPLAY_LIST_RING_DEPTH - 1).
+    /// @return The number of frames which is actually used
+    std::size_t setMaxFramesInFlight(const std::size_t frames);
+
+    /// @brief Enables the reordering of the draws within a frame. The triangles are recorded together with their
+    ///     state and are sorted by their textures and register values before they are added to the display lists.
+    ///     This saves texture streams when an application switches often between textures. Only opaque draws
+    ///     (depth tested and written, no blending, no stencil test) are reordered, all other draws keep their order.
+    ///     Not supported when the vertices are transformed by the threaded rasterizer.
+    /// @param enable true to enable the reordering
+    /// @return true if succeeded, false if the reordering is not supported
+    bool setDrawReordering(const bool enable);
+
+    /// @brief Queries how many texture streams were avoided by the draw reordering
+    /// @return The number of avoided texture streams
+    std::size_t getAvoidedTextureStreams() const { return m_drawSorter.getAvoidedTextureStreams(); }
+
 private:
     using DisplayListAssemblerType = displaylist::DisplayListAssembler<RenderConfig::TMU_COUNT, displaylist::DisplayList>;
-    using DisplayListAssemblerArrayType = std::array<DisplayListAssemblerType, RenderConfig::getDisplayLines()>;
+    // The display lines are followed by the segments which are chained to full display lists.
+    // Single lists are using the intermediate upload instead.
+    static constexpr std::size_t DISPLAY_LIST_OVERFLOW_SEGMENTS { (RenderConfig::getDisplayLines() == 1) ? 0 : RenderConfig::DISPLAY_LIST_OVERFLOW_SEGMENTS };
+    using DisplayListAssemblerArrayType = std::array<DisplayListAssemblerType, RenderConfig::getDisplayLines() + DISPLAY_LIST_OVERFLOW_SEGMENTS>;
     using TextureManagerType = TextureMemoryManager<RenderConfig>;
     using DisplayListDispatcherType = displaylist::DisplayListDispatcher<RenderConfig, DisplayListAssemblerArrayType>;
-    using DisplayListDoubleBufferType = displaylist::DisplayListDoubleBuffer<DisplayListDispatcherType>;
+    using DisplayListRingType = displaylist::DisplayListRing<DisplayListDispatcherType, RenderConfig::DISPLAY_LIST_RING_DEPTH>;
+    using TriangleCmdType = std::conditional_t<RenderConfig::THREADED_RASTERIZATION, RegularTriangleCmd, TriangleStreamCmd>;
+    using DrawSorterType = DrawSorter<RenderConfig, TriangleCmdType>;
 
     template <typename TArg>
     bool writeReg(const TArg& regVal)
     {
+        // The sorter always tracks the state. When the reordering is enabled, it also writes the registers.
+        if (m_drawSorter.writeRegister(regVal.getAddr(), regVal.serialize()) && m_drawSorter.isEnabled())
+        {
+            return true;
+        }
         return addCommand(WriteRegisterCmd { regVal });
     }
 
@@ -285,7 +370,13 @@ private:
     template <typename Factory, typename Pred>
     bool addCommandWithFactory_if(const Factory& commandFactory, const Pred& pred)
     {
-        return m_displayListBuffer.getBack().addCommandWithFactory_if(commandFactory, pred);
+        bool ret = m_displayListBuffer.getBack().addCommandWithFactory_if(commandFactory, pred);
+        if (!ret && m_displayListBuffer.getBack().singleList())
+        {
+            intermediateUpload();
+            ret = m_displayListBuffer.getBack().addCommandWithFactory_if(commandFactory, pred);
+        }
+        return ret;
     }
 
     template <typename Function>
@@ -301,32 +392,16 @@ private:
 
     void switchDisplayLists()
     {
-        m_displayListUploaderThread.wait();
+        m_displayListBuffer.getBack().finishParallelAssembly();
+        m_displayListBuffer.getBack().removeRedundantState();
+        m_textureManager.queueUploads(m_textureUploads[m_displayListBuffer.getBackIndex()]);
         m_displayListBuffer.swap();
     }
 
     template <typename TriangleCmd>
     bool addMultiListTriangle(TriangleCmd& triangleCmd)
     {
-        const auto factory = [&triangleCmd](DisplayListDispatcherType& dispatcher, const std::size_t i, const std::size_t, const std::size_t, const std::size_t resY)
-        {
-            const std::size_t currentScreenPositionStart = i * resY;
-            const std::size_t currentScreenPositionEnd = currentScreenPositionStart + resY;
-            if (triangleCmd.isInBounds(currentScreenPositionStart, currentScreenPositionEnd))
-            {
-                // The floating point rasterizer can automatically increment all attributes
-                if constexpr (RenderConfig::USE_FLOAT_INTERPOLATION)
-                {
-                    return dispatcher.addCommand(i, triangleCmd);
-                }
-                else
-                {
-                    return dispatcher.addCommand(i, triangleCmd.getIncremented(currentScreenPositionStart, currentScreenPositionEnd));
-                }
-            }
-            return true;
-        };
-        return displayListLooper(factory);
+        return m_displayListBuffer.getBack().addTriangleCommand(triangleCmd);
     }
 
     template <typename TriangleCmd>
@@ -337,6 +412,25 @@ private:
             return true;
         }
 
+        if (m_drawSorter.isEnabled())
+        {
+            if (m_drawSorter.addTriangle(triangleCmd))
+            {
+                return true;
+            }
+            // The sorter is full
+            flushDraws();
+            if (m_drawSorter.addTriangle(triangleCmd))
+            {
+                return true;
+            }
+        }
+        return addTriangleCmdToDisplayList(triangleCmd);
+    }
+
+    template <typename TriangleCmd>
+    bool addTriangleCmdToDisplayList(TriangleCmd& triangleCmd)
+    {
         if constexpr (DisplayListDispatcherType::singleList())
         {
             return addCommand(triangleCmd);
@@ -370,8 +464,9 @@ private:
     bool setDepthBufferAddress(const uint32_t addr) { return writeReg(DepthBufferAddrReg { addr }); }
     bool setStencilBufferAddress(const uint32_t addr) { return writeReg(StencilBufferAddrReg { addr }); }
     bool writeToTextureConfig(const std::size_t tmu, const uint16_t texId, TmuTextureReg tmuConfig);
+    bool streamTexture(const std::size_t tmu, const uint16_t texId);
     bool setColorBufferAddress(const uint32_t addr);
-    void uploadTextures();
+    void waitTillDeviceIsClearToSend();
     void swapFramebuffer();
     void intermediateUpload();
     void setYOffset();
@@ -380,6 +475,7 @@ private:
     void addCommitFramebufferCommand();
     void addColorBufferAddressOfTheScreen();
     void swapScreenToNewColorBuffer();
+    bool flushDraws();
 
     uint32_t m_colorBufferAddr {};
     bool m_selectedColorBuffer { true };
@@ -390,10 +486,26 @@ private:
     int32_t m_scissorYStart { 0 };
     int32_t m_scissorYEnd { 0 };
 
+    // The texture which the TMU has loaded. The TMU keeps it across the display lists and frames, therefore
+    // a texture is only streamed again when another texture was loaded or the data of the texture has changed.
+    struct TmuResidency
+    {
+        bool valid { false };
+        uint16_t texId { 0 };
+        uint32_t generation { 0 };
+    };
+    std::array<TmuResidency, RenderConfig::TMU_COUNT> m_tmuResidency {};
+
+    // The threaded rasterizer patches its copy of the vertex context with the dirty blocks.
+    // When an update was lost, the whole context has to be transferred again.
+    bool m_vertexCtxLost { false };
+    PushVertexBatchCmd::AttributeMask m_vertexAttributes { PushVertexBatchCmd::AttributeMask {}.set() };
+
     IDevice& m_device;
     IThreadRunner& m_displayListUploaderThread;
     TextureManagerType m_textureManager;
     Rasterizer m_rasterizer { !RenderConfig::USE_FLOAT_INTERPOLATION };
+    DrawSorterType m_drawSorter {};
 
     const std::function<bool(const TransformedTriangle&)> drawTriangleLambda = [this](const TransformedTriangle& triangle)
     { return drawTriangle(triangle); };
@@ -406,10 +518,33 @@ private:
         setStencilBufferConfigLambda,
     };
 
+    // Shared queue for the parallel display list assembly
+    std::array<IThreadRunner*, RenderConfig::DISPLAY_LIST_ASSEMBLY_MAX_WORKERS> m_displayListAssemblyWorkers {};
+    std::vector<uint8_t> m_commandQueueBuffer {};
+    DisplayListDispatcherType::CommandQueue m_commandQueue {};
+
+    // The state which is valid for all display lists. It is shared by the display list sets, because the frames
+    // are recorded one after another. The worker logs are the copies used by the parallel assembly.
+    DisplayListDispatcherType::StateLog m_stateLog {};
+    std::array<DisplayListDispatcherType::StateLog, RenderConfig::DISPLAY_LIST_ASSEMBLY_MAX_WORKERS> m_workerStateLogs {};
+
     // Instantiation of the displaylist assemblers
-    std::array<DisplayListAssemblerArrayType, 2> m_displayListAssembler {};
-    std::array<DisplayListDispatcherType, 2> m_displayListDispatcher { m_displayListAssembler[0], m_displayListAssembler[1] };
-    DisplayListDoubleBufferType m_displayListBuffer { m_displayListDispatcher[0], m_displayListDispatcher[1] };
+    template <std::size_t... I>
+    static std::array<DisplayListDispatcherType, sizeof...(I)> createDisplayListDispatchers(
+        std::array<DisplayListAssemblerArrayType, sizeof...(I)>& assemblers,
+        std::index_sequence<I...>)
+    {
+        return { DisplayListDispatcherType { assemblers[I] }... };
+    }
+
+    std::array<DisplayListAssemblerArrayType, RenderConfig::DISPLAY_LIST_RING_DEPTH> m_displayListAssembler {};
+    std::array<DisplayListDispatcherType, RenderConfig::DISPLAY_LIST_RING_DEPTH> m_displayListDispatcher {
+        createDisplayListDispatchers(m_displayListAssembler, std::make_index_sequence<RenderConfig::DISPLAY_LIST_RING_DEPTH> {})
+    };
+    DisplayListRingType m_displayListBuffer { m_displayListDispatcher };
+
+    // The textures which are uploaded together with the display list set of the same index
+    std::array<TextureManagerType::UploadQueue, RenderConfig::DISPLAY_LIST_RING_DEPTH> m_textureUploads {};
 };
 
 } // namespace rr
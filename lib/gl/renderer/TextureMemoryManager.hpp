@@ -19,13 +19,16 @@
 #define TEXTUREMEMORYMANAGER_HPP
 #include "TextureObject.hpp"
 #include "registers/TmuTextureReg.hpp"
+#include <algorithm>
 #include <array>
+#include <bitset>
 #include <cmath>
 #include <cstring>
 #include <functional>
 #include <optional>
 #include <spdlog/spdlog.h>
 #include <tcb/span.hpp>
+#include <vector>
 
 namespace rr
 {
@@ -54,6 +57,7 @@ public:
 
     bool createTextureWithName(const uint16_t texId)
     {
+        m_textureGeneration[texId]++;
         m_textureLut[texId] = allocTexture();
         if (m_textureLut[texId])
         {
@@ -75,6 +79,7 @@ public:
             return false;
         }
         bool ret = true;
+        m_textureGeneration[texId]++;
         std::size_t textureSlot = *m_textureLut[texId];
         const std::size_t textureSlotOld = *m_textureLut[texId];
 
@@ -227,32 +232,55 @@ public:
             return false;
         }
         const std::size_t texLutId = *m_textureLut[texId];
+        m_textureGeneration[texId]++;
         m_textureLut[texId] = std::nullopt;
         m_textureEntryFlags[texLutId].requiresDelete = true;
         m_textureUpdateRequired = true;
         return true;
     }
 
-    bool uploadTextures(const std::function<bool(uint32_t gramAddr, const tcb::span<const uint8_t> data)> uploader)
+    // The generation changes every time the texture id gets new data or is deleted. The id together with
+    // the generation identifies the data of a texture.
+    uint32_t getGeneration(const uint16_t texId) const
     {
+        return m_textureGeneration[texId];
+    }
+
+    bool textureUpdateRequired() const
+    {
+        return m_textureUpdateRequired;
+    }
+
+    // Queue of the textures which are uploaded together with a display list set
+    class UploadQueue;
+
+    // Moves the textures which require an upload into the queue and frees the deleted textures.
+    // The pages are marked as uploaded, the queue is responsible to upload them before they are used.
+    // The textures which the queue failed to upload during its previous use are marked again for an upload.
+    void queueUploads(UploadQueue& queue)
+    {
+        for (const typename UploadQueue::Upload& entry : queue.m_uploads)
+        {
+            TextureEntry& textureEntry = m_textureEntryFlags[entry.textureSlot];
+            if (textureEntry.inUse && !textureEntry.requiresDelete)
+            {
+                textureEntry.requiresUpload = textureEntry.requiresUpload || !entry.uploaded;
+                m_textureUpdateRequired = m_textureUpdateRequired || textureEntry.requiresUpload;
+            }
+        }
+        queue.m_uploads.clear();
+
         if (!m_textureUpdateRequired)
-            return true;
+            return;
 
-        // Upload textures
         for (std::size_t i = 0; i < RenderConfig::NUMBER_OF_TEXTURES; i++)
         {
             Texture& texture = m_textures[i];
             TextureEntry& textureEntry = m_textureEntryFlags[i];
             if (textureEntry.requiresUpload)
             {
-                bool ret { true };
-                std::array<uint8_t, TEXTURE_PAGE_SIZE> buffer;
-                std::size_t j = 0;
-                for (tcb::span<const uint8_t> b = texture.getPageData(j, buffer); !b.empty(); b = texture.getPageData(++j, buffer))
-                {
-                    ret = ret && uploader(static_cast<std::size_t>(texture.pageTable[j]) * TEXTURE_PAGE_SIZE, { buffer });
-                }
-                textureEntry.requiresUpload = !ret;
+                queue.m_uploads.push_back({ texture, i, false });
+                textureEntry.requiresUpload = false;
             }
 
             if (textureEntry.requiresDelete)
@@ -263,8 +291,7 @@ public:
                 deallocPages(texture);
             }
         }
-
-        return true;
+        m_textureUpdateRequired = false;
     }
 
 private:
@@ -399,10 +426,91 @@ private:
     std::array<Texture, RenderConfig::NUMBER_OF_TEXTURES> m_textures;
     std::array<TextureEntry, RenderConfig::NUMBER_OF_TEXTURES> m_textureEntryFlags {};
     std::array<std::optional<std::size_t>, RenderConfig::NUMBER_OF_TEXTURES> m_textureLut {};
+    std::array<uint32_t, RenderConfig::NUMBER_OF_TEXTURES> m_textureGeneration {};
     std::array<PageEntry, RenderConfig::NUMBER_OF_TEXTURE_PAGES> m_pageTable {};
 
     bool m_textureUpdateRequired { false };
 };
 
+// Queue of the textures which are uploaded together with a display list set. An upload holds a copy of the
+// texture, therefore it is independent of later changes in the texture manager and can run in another thread.
+// The uploads must be executed in the order in which they were queued.
+template <class RenderConfig>
+class TextureMemoryManager<RenderConfig>::UploadQueue
+{
+public:
+    using Pages = std::bitset<RenderConfig::NUMBER_OF_TEXTURE_PAGES>;
+    using Uploader = std::function<bool(uint32_t gramAddr, const tcb::span<const uint8_t> data)>;
+
+    // Uploads the queued textures which are using one of the pages
+    bool upload(const Pages& pages, const Uploader& uploader)
+    {
+        bool ret = true;
+        for (Upload& entry : m_uploads)
+        {
+            if (!entry.uploaded && entry.usesPages(pages))
+            {
+                ret = entry.upload(uploader) && ret;
+            }
+        }
+        return ret;
+    }
+
+    // Uploads the remaining textures. The textures which failed to upload are kept in the queue, the texture
+    // manager queues them again with the next use of the queue.
+    bool uploadAll(const Uploader& uploader)
+    {
+        bool ret = true;
+        for (Upload& entry : m_uploads)
+        {
+            if (!entry.uploaded)
+            {
+                ret = entry.upload(uploader) && ret;
+            }
+        }
+        m_uploads.erase(std::remove_if(m_uploads.begin(), m_uploads.end(), [](const Upload& entry)
+                            { return entry.uploaded; }),
+            m_uploads.end());
+        return ret;
+    }
+
+private:
+    friend class TextureMemoryManager;
+
+    struct Upload
+    {
+        Texture texture {};
+        std::size_t textureSlot { 0 };
+        bool uploaded { false };
+
+        bool usesPages(const Pages& pages) const
+        {
+            for (std::size_t j = 0; j < texture.pages; j++)
+            {
+                if (pages[texture.pageTable[j]])
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool upload(const Uploader& uploader)
+        {
+            bool ret { true };
+            std::array<uint8_t, TEXTURE_PAGE_SIZE> buffer;
+            std::size_t j = 0;
+            for (tcb::span<const uint8_t> b = texture.getPageData(j, buffer); !b.empty(); b = texture.getPageData(++j, buffer))
+            {
+                ret = ret && uploader(static_cast<std::size_t>(texture.pageTable[j]) * TEXTURE_PAGE_SIZE, { buffer });
+            }
+            uploaded = ret;
+            return ret;
+        }
+    };
+
+    std::vector<Upload> m_uploads {};
+};
+
 } // namespace rr
 #endif
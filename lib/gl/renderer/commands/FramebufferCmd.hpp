@@ -38,6 +38,11 @@ class FramebufferCmd
     static constexpr uint32_t OP_FRAMEBUFFER_SIZE_POS { 8 };
     static constexpr uint32_t OP_FRAMEBUFFER_SIZE_MASK { 0xFFFFF };
     static constexpr uint32_t OP_MASK { 0xF000'0000 };
+    static constexpr uint32_t BUFFER_SELECT_MASK { (OP_FRAMEBUFFER_COLOR_BUFFER_SELECT
+                                                       | OP_FRAMEBUFFER_DEPTH_BUFFER_SELECT
+                                                       | OP_FRAMEBUFFER_STENCIL_BUFFER_SELECT)
+        & ~OP_MASK };
+    static constexpr uint32_t SIZE_FIELD_MASK { OP_FRAMEBUFFER_SIZE_MASK << OP_FRAMEBUFFER_SIZE_POS };
 
 public:
     FramebufferCmd() = default;
@@ -102,6 +107,13 @@ public:
 
     static std::size_t getNumberOfElementsInPayloadByCommand(const uint32_t) { return 0; }
     static bool isThis(const CommandType cmd) { return (cmd & OP_MASK) == OP_FRAMEBUFFER; }
+    static bool isClear(const CommandType cmd) { return (cmd & ~(BUFFER_SELECT_MASK | SIZE_FIELD_MASK)) == OP_FRAMEBUFFER_MEMSET; }
+    // Two clears of the same size can be executed as one clear with the union of the selected buffers
+    static CommandType mergeClears(const CommandType a, const CommandType b) { return a | (b & BUFFER_SELECT_MASK); }
+    static bool canMergeClears(const CommandType a, const CommandType b)
+    {
+        return isClear(a) && isClear(b) && ((a & SIZE_FIELD_MASK) == (b & SIZE_FIELD_MASK));
+    }
 
 private:
     CommandType m_op {};
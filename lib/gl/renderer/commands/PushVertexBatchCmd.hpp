@@ -0,0 +1,277 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _PUSH_VERTEX_BATCH_CMD_HPP_
+#define _PUSH_VERTEX_BATCH_CMD_HPP_
+
+#include "RenderConfigs.hpp"
+#include "math/Vec.hpp"
+#include "transform/Types.hpp"
+#include "transform/VertexTransforming.hpp"
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <string.h>
+#include <tcb/span.hpp>
+
+namespace rr
+{
+
+// Transfers a batch of vertices to the threaded rasterizer. The attributes which are not used by the
+// current vertex context are omitted: the normal when neither the lighting nor a sphere or reflection
+// map needs it, and the texture coordinates of disabled TMUs. The bits 27:16 of the op encode the
+// transferred attributes, the bits 15:0 the payload size in words. Each vertex is serialized as
+// position, color, normal and texture coordinates in ascending TMU order.
+// When the vertices are tagged for the post transform vertex cache, the payload starts with the number
+// of vertices and every vertex is preceded by its tag. A vertex which reuses a cache entry only consists
+// of the tag.
+class PushVertexBatchCmd
+{
+    using VertexCtx = vertextransforming::VertexTransformingData;
+    static constexpr uint32_t PUSH_VERTEX_BATCH { 0xC000'0000 };
+    static constexpr uint32_t OP_MASK { 0xF000'0000 };
+    static constexpr uint32_t ATTRIBUTE_MASK_POS { 16 };
+    static constexpr uint32_t ATTRIBUTE_MASK_MASK { 0xFFF };
+    static constexpr uint32_t PAYLOAD_SIZE_MASK { 0xFFFF };
+    static constexpr uint32_t TAG_OP_POS { 30 };
+    static constexpr uint32_t TAG_ENTRY_MASK { 0xFFFF };
+
+public:
+    enum Attribute : std::size_t
+    {
+        NORMAL,
+        TEX_COORD_0,
+        CACHE_TAG = TEX_COORD_0 + RenderConfig::TMU_COUNT,
+        ATTRIBUTE_COUNT
+    };
+    using AttributeMask = std::bitset<ATTRIBUTE_COUNT>;
+
+private:
+    static constexpr std::size_t VEC3_SIZE { sizeof(Vec3) / sizeof(uint32_t) };
+    static constexpr std::size_t VEC4_SIZE { sizeof(Vec4) / sizeof(uint32_t) };
+    static constexpr std::size_t MAX_VERTEX_SIZE { (2 * VEC4_SIZE) + VEC3_SIZE + (RenderConfig::TMU_COUNT * VEC4_SIZE) };
+    static constexpr std::size_t MAX_PAYLOAD_SIZE { 1 + (RenderConfig::THREADED_RASTERIZATION_VERTEX_BATCH_SIZE * (1 + MAX_VERTEX_SIZE)) };
+    static_assert(ATTRIBUTE_COUNT <= 12, "Attribute mask does not fit into the op");
+    static_assert(MAX_PAYLOAD_SIZE <= PAYLOAD_SIZE_MASK, "Payload size does not fit into the op");
+
+public:
+    PushVertexBatchCmd() = default;
+    PushVertexBatchCmd(const tcb::span<const VertexParameter> vertices, const tcb::span<const VertexCacheTag> tags, const AttributeMask attributes)
+        : m_attributes { attributes }
+    {
+        // The vertices tagged with REUSE have no entry in vertices
+        const std::size_t count = (std::min)(tags.empty() ? vertices.size() : tags.size(), RenderConfig::THREADED_RASTERIZATION_VERTEX_BATCH_SIZE);
+        std::size_t vertexPos = 0;
+        m_attributes.set(CACHE_TAG, !tags.empty());
+        if (m_attributes[CACHE_TAG])
+        {
+            m_data[m_payloadSize++] = static_cast<uint32_t>(count);
+        }
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (m_attributes[CACHE_TAG])
+            {
+                m_data[m_payloadSize++] = (static_cast<uint32_t>(tags[i].op) << TAG_OP_POS) | tags[i].entry;
+                if (tags[i].op == VertexCacheTag::Op::REUSE)
+                {
+                    continue;
+                }
+            }
+            const VertexParameter& v = vertices[vertexPos++];
+            write(v.vertex.data(), VEC4_SIZE);
+            write(v.color.data(), VEC4_SIZE);
+            if (m_attributes[NORMAL])
+            {
+                write(v.normal.data(), VEC3_SIZE);
+            }
+            for (std::size_t tu = 0; tu < RenderConfig::TMU_COUNT; tu++)
+            {
+                if (m_attributes[TEX_COORD_0 + tu])
+                {
+                    write(v.tex[tu].data(), VEC4_SIZE);
+                }
+            }
+        }
+    }
+
+    // Returns the attributes which are used by the vertex transformation with the context ctx
+    static AttributeMask getAttributeMask(const VertexCtx& ctx)
+    {
+        AttributeMask attributes {};
+        bool normal = ctx.lighting.lightingEnabled;
+        for (std::size_t tu = 0; tu < RenderConfig::TMU_COUNT; tu++)
+        {
+            if (ctx.tmuEnabled[tu])
+            {
+                attributes.set(TEX_COORD_0 + tu);
+                normal = normal || texGenUsesNormal(ctx.texGen[tu]);
+            }
+        }
+        attributes.set(NORMAL, normal);
+        return attributes;
+    }
+
+    // Decodes the vertices of the payload and calls func with each of them and its cache tag.
+    // Returns false if one of the calls returned false.
+    template <typename TFunc>
+    static bool decode(const uint32_t op, tcb::span<const uint32_t> payload, const TFunc& func)
+    {
+        const AttributeMask attributes { (op >> ATTRIBUTE_MASK_POS) & ATTRIBUTE_MASK_MASK };
+        const std::size_t vertexSize = getVertexSize(attributes);
+        if (attributes[CACHE_TAG])
+        {
+            return decodeTagged(attributes, payload, func);
+        }
+        VertexParameter v;
+        // The omitted attributes are not used. They are only cleared to get a deterministic result.
+        v.normal.init();
+        for (std::size_t tu = 0; tu < RenderConfig::TMU_COUNT; tu++)
+        {
+            v.tex[tu].init();
+        }
+        bool ret = true;
+        for (std::size_t i = 0; (i + vertexSize) <= payload.size(); i += vertexSize)
+        {
+            readVertex(v, attributes, &payload[i]);
+            ret = func(v, VertexCacheTag {}) && ret;
+        }
+        return ret;
+    }
+
+    static std::size_t getVertexCount(const uint32_t op, tcb::span<const uint32_t> payload)
+    {
+        const AttributeMask attributes { (op >> ATTRIBUTE_MASK_POS) & ATTRIBUTE_MASK_MASK };
+        if (attributes[CACHE_TAG])
+        {
+            return payload.empty() ? 0 : payload[0];
+        }
+        return getNumberOfElementsInPayloadByCommand(op) / getVertexSize(attributes);
+    }
+
+    using PayloadType = tcb::span<const uint32_t>;
+    PayloadType payload() const { return { m_data.data(), m_payloadSize }; }
+    using CommandType = uint32_t;
+    CommandType command() const
+    {
+        return PUSH_VERTEX_BATCH
+            | (static_cast<uint32_t>(m_attributes.to_ulong()) << ATTRIBUTE_MASK_POS)
+            | static_cast<uint32_t>(m_payloadSize);
+    }
+
+    static std::size_t getNumberOfElementsInPayloadByCommand(const uint32_t cmd) { return cmd & PAYLOAD_SIZE_MASK; }
+    static bool isThis(const CommandType cmd) { return (cmd & OP_MASK) == PUSH_VERTEX_BATCH; }
+
+    PushVertexBatchCmd& operator=(const PushVertexBatchCmd&) = default;
+
+private:
+    static bool texGenUsesNormal(const texgen::TexGenData& texGen)
+    {
+        const auto usesNormal = [](const bool enable, const TexGenMode mode)
+        { return enable && ((mode == TexGenMode::SPHERE_MAP) || (mode == TexGenMode::REFLECTION_MAP)); };
+        return usesNormal(texGen.texGenEnableS, texGen.texGenModeS)
+            || usesNormal(texGen.texGenEnableT, texGen.texGenModeT)
+            || usesNormal(texGen.texGenEnableR, texGen.texGenModeR);
+    }
+
+    template <typename TFunc>
+    static bool decodeTagged(const AttributeMask attributes, tcb::span<const uint32_t> payload, const TFunc& func)
+    {
+        const std::size_t vertexSize = getVertexSize(attributes);
+        VertexParameter v;
+        v.normal.init();
+        for (std::size_t tu = 0; tu < RenderConfig::TMU_COUNT; tu++)
+        {
+            v.tex[tu].init();
+        }
+        bool ret = true;
+        std::size_t i = 1;
+        while (i < payload.size())
+        {
+            VertexCacheTag tag;
+            tag.op = static_cast<VertexCacheTag::Op>(payload[i] >> TAG_OP_POS);
+            tag.entry = static_cast<uint16_t>(payload[i] & TAG_ENTRY_MASK);
+            i++;
+            if (tag.op != VertexCacheTag::Op::REUSE)
+            {
+                if ((i + vertexSize) > payload.size())
+                {
+                    break;
+                }
+                readVertex(v, attributes, &payload[i]);
+                i += vertexSize;
+            }
+            ret = func(v, tag) && ret;
+        }
+        return ret;
+    }
+
+    static void readVertex(VertexParameter& v, const AttributeMask attributes, const uint32_t* data)
+    {
+        data = read(v.vertex, data);
+        data = read(v.color, data);
+        if (attributes[NORMAL])
+        {
+            data = read(v.normal, data);
+        }
+        for (std::size_t tu = 0; tu < RenderConfig::TMU_COUNT; tu++)
+        {
+            if (attributes[TEX_COORD_0 + tu])
+            {
+                data = read(v.tex[tu], data);
+            }
+        }
+    }
+
+    static std::size_t getVertexSize(const AttributeMask attributes)
+    {
+        std::size_t size = 2 * VEC4_SIZE;
+        if (attributes[NORMAL])
+        {
+            size += VEC3_SIZE;
+        }
+        for (std::size_t tu = 0; tu < RenderConfig::TMU_COUNT; tu++)
+        {
+            if (attributes[TEX_COORD_0 + tu])
+            {
+                size += VEC4_SIZE;
+            }
+        }
+        return size;
+    }
+
+    template <typename TVec>
+    static const uint32_t* read(TVec& vec, const uint32_t* data)
+    {
+        vec = reinterpret_cast<const float*>(data);
+        return data + (sizeof(TVec) / sizeof(uint32_t));
+    }
+
+    void write(const float* data, const std::size_t size)
+    {
+        memcpy(&m_data[m_payloadSize], data, size * sizeof(uint32_t));
+        m_payloadSize += size;
+    }
+
+    AttributeMask m_attributes {};
+    std::array<uint32_t, MAX_PAYLOAD_SIZE> m_data;
+    std::size_t m_payloadSize { 0 };
+};
+
+} // namespace rr
+
+#endif // _PUSH_VERTEX_BATCH_CMD_HPP_
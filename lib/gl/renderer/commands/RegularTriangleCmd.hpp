@@ -77,6 +77,13 @@ public:
         m_bbEndY = (std::max)((std::max)(t.vertex0[1], t.vertex1[1]), t.vertex2[1]);
     }
 
+    RegularTriangleCmd(const RegularTriangle& triangle)
+    {
+        m_desc[0] = triangle;
+        m_bbStartY = (std::min)((std::min)(triangle.vertex0[1], triangle.vertex1[1]), triangle.vertex2[1]);
+        m_bbEndY = (std::max)((std::max)(triangle.vertex0[1], triangle.vertex1[1]), triangle.vertex2[1]);
+    }
+
     RegularTriangleCmd(const RegularTriangleCmd& c) { operator=(c); }
 
     bool isInBounds(const std::size_t lineStart, const std::size_t lineEnd) const
@@ -84,6 +91,9 @@ public:
         return ((m_bbEndY >= lineStart) && (m_bbStartY < lineEnd));
     }
 
+    std::size_t getBbStartY() const { return m_bbStartY; }
+    std::size_t getBbEndY() const { return m_bbEndY; }
+
     const RegularTriangleCmd& getIncremented(const std::size_t lineStart, const std::size_t lineEnd)
     {
         m_desc[0].lineStart = lineStart;
@@ -23,6 +23,7 @@
 #include "transform/VertexTransforming.hpp"
 #include <array>
 #include <cstdint>
+#include <string.h>
 #include <tcb/span.hpp>
 #include <type_traits>
 #include <typeinfo>
@@ -30,38 +31,84 @@
 namespace rr
 {
 
+// Transfers the vertex context to the threaded rasterizer. The command can carry the whole context
+// or only a subset of its blocks (a delta). The bits 27:16 of the op encode the transferred blocks,
+// the bits 15:0 the payload size in words. The blocks are serialized in ascending order, each block
+// padded to a multiple of a word.
 class SetVertexCtxCmd
 {
+    using VertexCtx = vertextransforming::VertexTransformingData;
     static constexpr uint32_t SET_VERTEX_CTX { 0xE000'0000 };
     static constexpr uint32_t OP_MASK { 0xF000'0000 };
+    static constexpr uint32_t BLOCK_MASK_POS { 16 };
+    static constexpr uint32_t BLOCK_MASK_MASK { 0xFFF };
+    static constexpr uint32_t PAYLOAD_SIZE_MASK { 0xFFFF };
+    static constexpr std::size_t MAX_PAYLOAD_SIZE { (sizeof(VertexCtx) + (VertexCtx::BLOCK_COUNT * (sizeof(uint32_t) - 1))) / sizeof(uint32_t) };
+    static_assert(VertexCtx::BLOCK_COUNT <= 12, "Block mask does not fit into the op");
+    static_assert(MAX_PAYLOAD_SIZE <= PAYLOAD_SIZE_MASK, "Payload size does not fit into the op");
 
 public:
-    struct VertexCtx
+    SetVertexCtxCmd() = default;
+    SetVertexCtxCmd(const VertexCtx& ctx)
+        : SetVertexCtxCmd { ctx, VertexCtx::DirtyBits {}.set() }
     {
-#pragma pack(push, 4)
-        vertextransforming::VertexTransformingData ctx;
-#pragma pack(pop)
-        VertexCtx& operator=(const VertexCtx&) = default;
-    };
+    }
 
-    SetVertexCtxCmd() = default;
-    SetVertexCtxCmd(const vertextransforming::VertexTransformingData& ctx)
+    SetVertexCtxCmd(const VertexCtx& ctx, const VertexCtx::DirtyBits blocks)
+        : m_blocks { blocks }
+    {
+        for (std::size_t i = 0; i < VertexCtx::BLOCK_COUNT; i++)
+        {
+            if (m_blocks[i])
+            {
+                const tcb::span<const uint8_t> block = ctx.getBlock(i);
+                const std::size_t words = getSizeInWords(block.size());
+                m_data[m_payloadSize + words - 1] = 0; // Clear the padding
+                memcpy(&m_data[m_payloadSize], block.data(), block.size());
+                m_payloadSize += words;
+            }
+        }
+    }
+
+    // Patches the blocks contained in the payload into ctx
+    static void apply(const uint32_t op, tcb::span<const uint32_t> payload, VertexCtx& ctx)
     {
-        m_desc[0].ctx = ctx;
+        const VertexCtx::DirtyBits blocks { (op >> BLOCK_MASK_POS) & BLOCK_MASK_MASK };
+        for (std::size_t i = 0; i < VertexCtx::BLOCK_COUNT; i++)
+        {
+            if (blocks[i])
+            {
+                const tcb::span<uint8_t> block = ctx.getBlock(i);
+                memcpy(block.data(), payload.data(), block.size());
+                payload = payload.subspan(getSizeInWords(block.size()));
+            }
+        }
     }
 
-    using PayloadType = std::array<VertexCtx, 1>;
-    const PayloadType& payload() const { return m_desc; }
+    using PayloadType = tcb::span<const uint32_t>;
+    PayloadType payload() const { return { m_data.data(), m_payloadSize }; }
     using CommandType = uint32_t;
-    static constexpr CommandType command() { return SET_VERTEX_CTX | (displaylist::DisplayList::template sizeOf<VertexCtx>()); }
+    CommandType command() const
+    {
+        return SET_VERTEX_CTX
+            | (static_cast<uint32_t>(m_blocks.to_ulong()) << BLOCK_MASK_POS)
+            | static_cast<uint32_t>(m_payloadSize);
+    }
 
-    static std::size_t getNumberOfElementsInPayloadByCommand(const uint32_t) { return std::tuple_size<PayloadType> {}; }
+    static std::size_t getNumberOfElementsInPayloadByCommand(const uint32_t cmd) { return cmd & PAYLOAD_SIZE_MASK; }
     static bool isThis(const CommandType cmd) { return (cmd & OP_MASK) == SET_VERTEX_CTX; }
 
     SetVertexCtxCmd& operator=(const SetVertexCtxCmd&) = default;
 
 private:
-    PayloadType m_desc;
+    static constexpr std::size_t getSizeInWords(const std::size_t size)
+    {
+        return (size + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+    }
+
+    VertexCtx::DirtyBits m_blocks {};
+    std::array<uint32_t, MAX_PAYLOAD_SIZE> m_data;
+    std::size_t m_payloadSize { 0 };
 };
 
 } // namespace rr
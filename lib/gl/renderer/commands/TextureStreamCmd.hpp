@@ -34,6 +34,7 @@ class TextureStreamCmd
     static constexpr uint32_t TEXTURE_STREAM_SIZE_POS { 0 }; // size: 18 bit
     static constexpr uint32_t TEXTURE_STREAM_SIZE_MASK { 0x3FFFF }; // size: 18 bit
     static constexpr uint32_t TEXTURE_STREAM_TMU_NR_POS { 19 }; // size: 2 bit
+    static constexpr uint32_t TEXTURE_STREAM_TMU_NR_MASK { 0x3 }; // size: 2 bit
     static constexpr uint32_t OP_MASK { 0xF000'0000 };
 
 public:
@@ -62,8 +63,11 @@ public:
         return OP_TEXTURE_STREAM | texSize | tmuShifted;
     }
 
+    static constexpr std::size_t getMaxNumberOfElementsInPayload() { return MAX_PAGES; }
     static std::size_t getNumberOfElementsInPayloadByCommand(const uint32_t cmd) { return cmd & TEXTURE_STREAM_SIZE_MASK; }
+    static std::size_t getTmuByCommand(const uint32_t cmd) { return (cmd >> TEXTURE_STREAM_TMU_NR_POS) & TEXTURE_STREAM_TMU_NR_MASK; }
     static bool isThis(const CommandType cmd) { return (cmd & OP_MASK) == OP_TEXTURE_STREAM; }
+    static std::size_t getPageByAddress(const uint32_t addr) { return (addr - RenderConfig::GRAM_MEMORY_LOC) / RenderConfig::TEXTURE_PAGE_SIZE; }
 
 private:
     std::size_t m_tmu {};
@@ -49,6 +49,12 @@ public:
         m_visible = rasterizer.rasterize(m_desc[0], triangle);
     }
 
+    TriangleStreamCmd(const TriangleStreamTypes::TriangleDesc& desc)
+    {
+        m_desc[0] = desc;
+        m_visible = true;
+    }
+
     TriangleStreamCmd(const TriangleStreamCmd& c) { operator=(c); }
 
     bool isInBounds(const std::size_t lineStart, const std::size_t lineEnd) const
@@ -56,6 +62,9 @@ public:
         return Rasterizer::checkIfTriangleIsInBounds(m_desc[0].param, lineStart, lineEnd);
     }
 
+    std::size_t getBbStartY() const { return m_desc[0].param.bbStartY; }
+    std::size_t getBbEndY() const { return m_desc[0].param.bbEndY; }
+
     TriangleStreamCmd getIncremented(const std::size_t lineStart, const std::size_t lineEnd)
     {
         TriangleStreamCmd cmd = *this;
@@ -81,7 +90,7 @@ public:
     static bool isThis(const CommandType cmd) { return (cmd & OP_MASK) == TRIANGLE_STREAM; }
 
 private:
-    std::array<TriangleStreamTypes::TriangleDesc, 1> m_desc;
+    std::array<TriangleStreamTypes::TriangleDesc, 1> m_desc {};
     bool m_visible { false };
 };
 
@@ -0,0 +1,74 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef CLEARMERGEOPTIMIZER_HPP
+#define CLEARMERGEOPTIMIZER_HPP
+
+#include "renderer/commands/FramebufferCmd.hpp"
+#include <stdint.h>
+#include <type_traits>
+
+namespace rr::displaylist
+{
+// Optimizer pass for clears: Two directly following clears (for instance a clear of the color buffer
+// and a clear of the depth buffer) are merged into one clear which selects both buffers.
+class ClearMergeOptimizer
+{
+public:
+    void reset()
+    {
+        m_lastClearValid = false;
+    }
+
+    template <typename TCommand, typename TOptimizer>
+    bool filter(const typename TOptimizer::CommandInfo& cmd, TOptimizer& optimizer)
+    {
+        if constexpr (std::is_same<TCommand, FramebufferCmd>::value)
+        {
+            // Only merge when no other command was added in between. A register write could have
+            // changed the clear configuration.
+            if (m_lastClearValid
+                && (m_lastClearEnd == optimizer.getWritePos())
+                && FramebufferCmd::canMergeClears(m_lastClearOp, cmd.op))
+            {
+                m_lastClearOp = FramebufferCmd::mergeClears(m_lastClearOp, cmd.op);
+                *(optimizer.template getCommand<typename FramebufferCmd::CommandType>(m_lastClearPos)) = m_lastClearOp;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename TCommand, typename TOptimizer>
+    void added(const typename TOptimizer::CommandInfo& cmd, TOptimizer&)
+    {
+        m_lastClearValid = std::is_same<TCommand, FramebufferCmd>::value && FramebufferCmd::isClear(cmd.op);
+        m_lastClearOp = cmd.op;
+        m_lastClearPos = cmd.pos;
+        m_lastClearEnd = cmd.pos + cmd.size;
+    }
+
+private:
+    bool m_lastClearValid { false };
+    uint32_t m_lastClearOp {};
+    std::size_t m_lastClearPos {};
+    std::size_t m_lastClearEnd {};
+};
+
+} // namespace rr::displaylist
+
+#endif // CLEARMERGEOPTIMIZER_HPP
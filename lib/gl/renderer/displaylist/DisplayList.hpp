@@ -36,7 +36,7 @@ public:
 
     // Interface for writing the display list
 
-    void* __restrict alloc(const std::size_t size)
+    void* alloc(const std::size_t size)
     {
         if ((size + writePos) <= mem.size())
         {
@@ -48,7 +48,7 @@ public:
     }
 
     template <typename GET_TYPE>
-    GET_TYPE* __restrict create()
+    GET_TYPE* create()
     {
         static constexpr std::size_t size = sizeOf<GET_TYPE>();
         return reinterpret_cast<GET_TYPE* __restrict>(alloc(size));
@@ -101,10 +101,21 @@ public:
         return writePos;
     }
 
+    template <typename GET_TYPE>
+    GET_TYPE* getAt(const std::size_t pos)
+    {
+        return reinterpret_cast<GET_TYPE* __restrict>(&mem[pos]);
+    }
+
+    void moveArea(const std::size_t dst, const std::size_t src, const std::size_t size)
+    {
+        memmove(&mem[dst], &mem[src], size);
+    }
+
     // Interface for reading the display list
 
     template <typename GET_TYPE>
-    const GET_TYPE* __restrict lookAhead(const std::size_t token = 1) const
+    const GET_TYPE* lookAhead(const std::size_t token = 1) const
     {
         static constexpr std::size_t size = sizeOf<GET_TYPE>();
         if (((size * token) + readPos) <= writePos)
@@ -115,7 +126,7 @@ public:
     }
 
     template <typename GET_TYPE>
-    const GET_TYPE* __restrict getNext()
+    const GET_TYPE* getNext()
     {
         static constexpr std::size_t size = sizeOf<GET_TYPE>();
         if ((size + readPos) <= writePos)
@@ -127,11 +138,30 @@ public:
         return nullptr;
     }
 
+    // Returns count consecutive elements and moves the read position behind them
+    template <typename GET_TYPE>
+    const GET_TYPE* getNextArray(const std::size_t count)
+    {
+        static constexpr std::size_t size = sizeOf<GET_TYPE>();
+        if (((size * count) + readPos) <= writePos)
+        {
+            void* memPlace = mem.data() + readPos;
+            readPos += size * count;
+            return reinterpret_cast<GET_TYPE* __restrict>(memPlace);
+        }
+        return nullptr;
+    }
+
     bool atEnd() const
     {
         return writePos <= readPos;
     }
 
+    std::size_t getCurrentReadPos() const
+    {
+        return readPos;
+    }
+
     void resetGet()
     {
         readPos = 0;
@@ -18,8 +18,12 @@
 #ifndef DISPLAYLISTASSEMBLER_HPP
 #define DISPLAYLISTASSEMBLER_HPP
 
+#include "ClearMergeOptimizer.hpp"
+#include "DisplayListOptimizer.hpp"
 #include "RIXDisplayListAssembler.hpp"
+#include "RegisterWriteOptimizer.hpp"
 #include "TextureLoadOptimizer.hpp"
+#include "renderer/commands/NopCmd.hpp"
 #include <algorithm>
 #include <array>
 #include <bitset>
@@ -57,7 +61,59 @@ public:
     void clearAssembler()
     {
         m_displayList.clear();
-        m_textureLoadOptimizer.reset();
+        if constexpr (Optimize)
+        {
+            m_optimizer.reset();
+        }
+    }
+
+    // Must be called when the display list is complete and before it is transferred
+    void finish()
+    {
+        if constexpr (Optimize)
+        {
+            m_optimizer.compact();
+        }
+    }
+
+    // Removes the state changes at the end of the display list, which are not used by any command of this
+    // display list. The removed commands are still accessible via trailing till the display list is cleared.
+    // Returns false if there is nothing to remove.
+    bool removeTrailingStateCommands(TDisplayList& trailing)
+    {
+        if constexpr (Optimize)
+        {
+            const std::size_t start = m_optimizer.getLastConsumerEnd();
+            const std::size_t size = m_displayList.getSize();
+            if ((start == 0) || (start >= size))
+            {
+                return false;
+            }
+            trailing.setBuffer({ m_displayList.template getAt<uint8_t>(start), size - start });
+            trailing.setCurrentSize(size - start);
+            trailing.resetGet();
+            m_displayList.setCurrentSize(start);
+            return true;
+        }
+        return false;
+    }
+
+    // Removes a command which was added before. The command is overwritten with NOPs.
+    void eliminateCommand(const std::size_t pos, const std::size_t size)
+    {
+        if (NopCmd::isThis(*(m_displayList.template getAt<uint32_t>(pos))))
+        {
+            // Already eliminated
+            return;
+        }
+        if constexpr (Optimize)
+        {
+            m_optimizer.eliminate(pos, size);
+        }
+        else
+        {
+            m_displayList.initArea(pos, size);
+        }
     }
 
     template <typename TCommand>
@@ -75,6 +131,28 @@ public:
     template <typename TCommand>
     bool copyCommand(TDisplayList& src)
     {
+        if constexpr (Optimize)
+        {
+            const typename TCommand::CommandType op = *(src.template lookAhead<typename TCommand::CommandType>());
+            const std::size_t payloadSize = TCommand::getNumberOfElementsInPayloadByCommand(op);
+            const typename Optimizer::CommandInfo info {
+                op,
+                Optimizer::template isRegisterWrite<TCommand>() ? *(src.template lookAhead<uint32_t>(2)) : 0u,
+                m_displayList.getCurrentWritePos(),
+                getCommandSize<TCommand>(payloadSize),
+            };
+            if (!m_optimizer.template filter<TCommand>(info))
+            {
+                skipCommand<TCommand>(src, payloadSize);
+                return true;
+            }
+            if (!m_rixDisplayListAssembler.template copyCommand<TCommand>(src))
+            {
+                return false;
+            }
+            m_optimizer.template added<TCommand>(info);
+            return true;
+        }
         return m_rixDisplayListAssembler.template copyCommand<TCommand>(src);
     }
 
@@ -83,12 +161,43 @@ public:
     {
         if constexpr (Optimize)
         {
-            m_textureLoadOptimizer.optimize(cmd);
+            const typename Optimizer::CommandInfo info {
+                cmd.command(),
+                getRegisterValue(cmd),
+                m_displayList.getCurrentWritePos(),
+                getCommandSize(cmd),
+            };
+            if (!m_optimizer.template filter<TCommand>(info))
+            {
+                return true;
+            }
+            if (!m_rixDisplayListAssembler.addCommand(cmd))
+            {
+                return false;
+            }
+            m_optimizer.template added<TCommand>(info);
+            return true;
         }
         return m_rixDisplayListAssembler.addCommand(cmd);
     }
 
 private:
+    // The passes of the peephole optimizer. Further passes can be plugged in here.
+    using Optimizer = DisplayListOptimizer<TDisplayList,
+        TextureLoadOptimizer<TMU_COUNT>,
+        RegisterWriteOptimizer,
+        ClearMergeOptimizer>;
+
+    template <typename TCommand>
+    static uint32_t getRegisterValue(const TCommand& cmd)
+    {
+        if constexpr (Optimizer::template isRegisterWrite<TCommand>())
+        {
+            return cmd.payload()[0];
+        }
+        return 0;
+    }
+
     template <typename TCommand>
     bool hasDisplayListEnoughSpace(const TCommand& cmd)
     {
@@ -99,9 +208,19 @@ private:
         return true;
     }
 
+    template <typename TCommand>
+    static void skipCommand(TDisplayList& src, const std::size_t payloadSize)
+    {
+        src.template getNext<typename TCommand::CommandType>();
+        for (std::size_t i = 0; i < payloadSize; i++)
+        {
+            src.template getNext<typename TCommand::PayloadType::value_type>();
+        }
+    }
+
     TDisplayList m_displayList {};
     RIXDisplayListAssembler<TDisplayList> m_rixDisplayListAssembler { m_displayList };
-    TextureLoadOptimizer<TMU_COUNT, TDisplayList> m_textureLoadOptimizer { m_displayList };
+    Optimizer m_optimizer { m_displayList };
     std::size_t m_displayListBufferId { 0 };
 };
 
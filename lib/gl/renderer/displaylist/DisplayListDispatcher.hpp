@@ -18,8 +18,25 @@
 #ifndef DISPLAYLISTDISPATCHER_HPP
 #define DISPLAYLISTDISPATCHER_HPP
 
+#include "DisplayListStateLog.hpp"
+#include "IThreadRunner.hpp"
+#include "SharedCommandQueue.hpp"
+#include "renderer/commands/FogLutStreamCmd.hpp"
+#include "renderer/commands/FramebufferCmd.hpp"
+#include "renderer/commands/NopCmd.hpp"
+#include "renderer/commands/RegularTriangleCmd.hpp"
+#include "renderer/commands/TextureStreamCmd.hpp"
+#include "renderer/commands/TriangleStreamCmd.hpp"
+#include "renderer/commands/WriteRegisterCmd.hpp"
+#include "renderer/registers/BaseColorReg.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <spdlog/spdlog.h>
 #include <stdint.h>
 #include <tcb/span.hpp>
+#include <type_traits>
 
 namespace rr::displaylist
 {
@@ -28,27 +45,52 @@ template <typename RenderConfig, typename TDisplayListAssembler>
 class DisplayListDispatcher
 {
 public:
+    using CommandQueue = SharedCommandQueue<RenderConfig::DISPLAY_LIST_ASSEMBLY_MAX_WORKERS>;
+    using StateLog = DisplayListStateLog<RenderConfig::TMU_COUNT>;
+    using TexturePages = std::bitset<RenderConfig::NUMBER_OF_TEXTURE_PAGES>;
+
     DisplayListDispatcher(TDisplayListAssembler& displayListAssembler)
         : m_displayListAssembler { displayListAssembler }
     {
+        resetSegments();
+        m_stateCursor.fill({});
     }
 
     template <typename Command>
     bool addCommand(const std::size_t index, const Command& cmd)
     {
-        return m_displayListAssembler[index].addCommand(cmd);
+        if (m_parallelAssemblyRunning)
+        {
+            return m_commandQueue->push(index, 0, 0, cmd) && !assemblyFailed();
+        }
+        return addToDisplayList(index, cmd);
     }
 
     template <typename Command>
     bool addLastCommand(const Command& cmd)
     {
         const std::size_t lastLine = reverseDisplayListIndex(m_displayLines - 1);
-        return m_displayListAssembler[lastLine].addCommand(cmd);
+        return addCommand(lastLine, cmd);
     }
 
     template <typename Command>
     bool addCommand(const Command& cmd)
     {
+        if (m_parallelAssemblyRunning)
+        {
+            // The workers are recording the state commands into their own logs
+            const bool ret = m_commandQueue->push(CommandQueue::TARGET_ALL, 0, 0, cmd);
+            if (ret)
+            {
+                recordState(cmd);
+            }
+            return ret && !assemblyFailed();
+        }
+        if (recordState(cmd))
+        {
+            // The display lists are fetching the state from the log when they are using it
+            return true;
+        }
         bool ret = true;
         for (std::size_t i = 0; i < m_displayLines; i++)
         {
@@ -94,6 +136,49 @@ public:
         return ret;
     }
 
+    template <typename Function>
+    bool displayListBinner(const std::size_t lineStart, const std::size_t lineEnd, const Function& func)
+    {
+        // Only calls func for the display lists which are covered by the lines, instead of testing every display list.
+        std::size_t firstLine;
+        std::size_t lastLine;
+        if (!coveredDisplayLists(lineStart, lineEnd, firstLine, lastLine))
+        {
+            return true;
+        }
+
+        bool ret = true;
+        for (std::size_t i = firstLine; i <= lastLine; i++)
+        {
+            ret = ret && func(*this, i, m_displayLines, m_xResolution, m_yLineResolution);
+        }
+        return ret;
+    }
+
+    template <typename TriangleCmd>
+    bool addTriangleCommand(TriangleCmd& triangleCmd)
+    {
+        if (m_parallelAssemblyRunning)
+        {
+            // The triangle is only queued once. The workers are doing the binning and incrementing.
+            std::size_t firstLine;
+            std::size_t lastLine;
+            if (!coveredDisplayLists(triangleCmd.getBbStartY(), triangleCmd.getBbEndY(), firstLine, lastLine))
+            {
+                return true;
+            }
+            return m_commandQueue->push(CommandQueue::TARGET_BIN, firstLine, lastLine, triangleCmd) && !assemblyFailed();
+        }
+        return displayListBinner(triangleCmd.getBbStartY(), triangleCmd.getBbEndY(),
+            [&triangleCmd](DisplayListDispatcher& dispatcher, const std::size_t i, const std::size_t, const std::size_t, const std::size_t)
+            { return dispatcher.addTriangleCommand(i, triangleCmd); });
+    }
+
+    std::size_t getSkippedDisplayListInserts() const
+    {
+        return m_skippedDisplayListInserts;
+    }
+
     bool setResolution(const std::size_t x, const std::size_t y)
     {
         const std::size_t framebufferSize = x * y;
@@ -105,9 +190,16 @@ public:
             return false;
         }
 
+        // The workers are using the resolution. Therefore they have to be stopped while changing it.
+        const bool restartParallelAssembly = m_parallelAssemblyRunning;
+        finishParallelAssembly();
         m_yLineResolution = y / framebufferLines;
         m_xResolution = x;
         m_displayLines = framebufferLines;
+        if (restartParallelAssembly)
+        {
+            startParallelAssembly();
+        }
         return true;
     }
 
@@ -139,23 +231,500 @@ public:
 
     void clearDisplayListAssembler()
     {
+        finishParallelAssembly();
         for (std::size_t i = 0; i < m_displayLines; i++)
         {
             m_displayListAssembler[i].clearAssembler();
         }
+        resetSegments();
+        m_stateCursor.fill({});
+        for (TexturePages& pages : m_texturePages)
+        {
+            pages.reset();
+        }
+        startParallelAssembly();
+    }
+
+    // Sets the log for the state which is valid for all display lists. The state is only added to a display
+    // list when a command of this display list is using it. The registers are added before the first command
+    // which is using the state, textures and the fog LUT only before triangles. Multi lists only, a single list
+    // is using every state anyway. The worker logs are the copies for the parallel assembly, one per worker.
+    void setStateLogs(StateLog* stateLog, tcb::span<StateLog> workerStateLogs)
+    {
+        finishParallelAssembly();
+        m_stateLog = stateLog;
+        m_workerStateLogs = workerStateLogs;
+    }
+
+    // Removes the state at the beginning of the display lists, which the hardware already has, because the
+    // display list executed before has left the same state. Must be called when the frame is complete.
+    // The frames must be resolved in the order in which they are executed.
+    void removeRedundantState()
+    {
+        if constexpr (!singleList())
+        {
+            if (!m_stateLog)
+            {
+                return;
+            }
+            finishParallelAssembly();
+            typename StateLog::Versions& resident = m_stateLog->getResidentVersions();
+            for (std::size_t i = 0; i < m_displayLines; i++)
+            {
+                const StateCursor& cursor = m_stateCursor[reverseDisplayListIndex(i)];
+                for (std::size_t j = 0; j < cursor.snapshotCount; j++)
+                {
+                    const StateSnapshot& snapshot = cursor.snapshots[j];
+                    if (resident[snapshot.slot] == snapshot.version)
+                    {
+                        m_displayListAssembler[snapshot.segment].eliminateCommand(snapshot.pos, snapshot.size);
+                    }
+                }
+                for (std::size_t slot = 0; slot < StateLog::SLOT_COUNT; slot++)
+                {
+                    if (cursor.written[slot])
+                    {
+                        resident[slot] = cursor.direct[slot] ? StateLog::UNKNOWN_VERSION : cursor.versions[slot];
+                    }
+                }
+            }
+        }
+    }
+
+    // Sets the number of segments which can be chained to full display lists. The segments are the
+    // assemblers behind the display lines and must have a buffer.
+    void setOverflowSegments(const std::size_t count)
+    {
+        m_overflowSegments = (std::min)(count, SEGMENT_COUNT - RenderConfig::getDisplayLines());
+    }
+
+    // Finishes all segments of a display list and calls func(bufferId, size) for every segment
+    // in the order in which the segments have to be streamed.
+    template <typename Function>
+    bool displayListSegmentLooper(const std::size_t displayList, const Function& func)
+    {
+        bool ret = true;
+        for (std::size_t i = displayList; ret && (i != NO_SEGMENT); i = m_nextSegment[i])
+        {
+            m_displayListAssembler[i].finish();
+            ret = func(m_displayListAssembler[i].getDisplayListBufferId(), m_displayListAssembler[i].getDisplayListSize());
+        }
+        return ret;
+    }
+
+    // The texture pages which are streamed by a display list. The pages must be uploaded before the display list.
+    const TexturePages& getTexturePages(const std::size_t displayList) const
+    {
+        return m_texturePages[displayList];
+    }
+
+    // Moves the state changes at the end of the display list of src, which are not used by any command
+    // of src, to the beginning of this display list. Only valid for single lists, because then this display
+    // list is directly executed after src. The optimizer can then remove the state changes, if they are
+    // overwritten before they are used.
+    bool takeOverTrailingStateCommands(DisplayListDispatcher& src)
+    {
+        if (!singleList())
+        {
+            return true;
+        }
+        DisplayList trailing {};
+        if (!src.m_displayListAssembler[0].removeTrailingStateCommands(trailing))
+        {
+            return true;
+        }
+        while (!trailing.atEnd())
+        {
+            if (NopCmd::isThis(*(trailing.template lookAhead<typename NopCmd::CommandType>())))
+            {
+                // Eliminated command
+                trailing.template getNext<typename NopCmd::CommandType>();
+                continue;
+            }
+            if (!copyQueuedCommand(0, trailing, false))
+            {
+                return false;
+            }
+        }
+        return true;
     }
 
-    std::size_t getDisplayListBufferId(std::size_t displayList) const
+    void setParallelAssemblyWorkers(CommandQueue* commandQueue, tcb::span<IThreadRunner* const> workers)
     {
-        return m_displayListAssembler[displayList].getDisplayListBufferId();
+        finishParallelAssembly();
+        m_commandQueue = commandQueue;
+        m_workers = workers;
     }
 
-    std::size_t getDisplayListSize(std::size_t displayList) const
+    // Starts the workers which are filling the display lists. Every command added afterwards is
+    // queued into the shared command queue. Each worker fills a disjunct set of display lists.
+    void startParallelAssembly()
     {
-        return m_displayListAssembler[displayList].getDisplayListSize();
+        if (singleList() || m_parallelAssemblyRunning || !m_commandQueue || m_workers.empty())
+        {
+            return;
+        }
+        m_commandQueue->reset(m_workers.size());
+        if (m_stateLog)
+        {
+            std::fill(m_workerStateLogs.begin(), m_workerStateLogs.begin() + m_workers.size(), *m_stateLog);
+        }
+        m_assemblyFailed.store(false, std::memory_order_relaxed);
+        m_parallelAssemblyRunning = true;
+        for (std::size_t i = 0; i < m_workers.size(); i++)
+        {
+            m_workers[i]->run([this, i]()
+                { return runWorker(i); });
+        }
+    }
+
+    // Waits till the workers have processed all queued commands. Afterwards, the commands are
+    // directly added to the display lists.
+    void finishParallelAssembly()
+    {
+        if (!m_parallelAssemblyRunning)
+        {
+            return;
+        }
+        m_commandQueue->close();
+        for (IThreadRunner* worker : m_workers)
+        {
+            worker->wait();
+        }
+        m_parallelAssemblyRunning = false;
     }
 
 private:
+    static constexpr std::size_t SEGMENT_COUNT { std::tuple_size<TDisplayListAssembler>::value };
+    static constexpr std::size_t NO_SEGMENT { SEGMENT_COUNT };
+
+    // State of the log which a display list has seen
+    struct StateSnapshot
+    {
+        uint32_t slot;
+        uint32_t segment;
+        uint32_t pos;
+        uint32_t size;
+        uint64_t version;
+    };
+
+    struct StateCursor
+    {
+        typename StateLog::Versions versions; // Versions of the slots in the display list
+        uint64_t registerVersion; // Log version when the registers were added the last time
+        uint64_t version; // Log version when all slots were added the last time
+        std::bitset<StateLog::SLOT_COUNT> written; // Slots which are written in the display list
+        std::bitset<StateLog::SLOT_COUNT> direct; // Slots which are last written with a display list specific value
+        std::array<StateSnapshot, StateLog::SLOT_COUNT> snapshots; // The first write of a slot from the log
+        std::size_t snapshotCount;
+    };
+
+    template <typename Command>
+    bool addToDisplayList(const std::size_t index, const Command& cmd)
+    {
+        if (!addStateFromLog<Command>(index) || !appendToDisplayList(index, cmd))
+        {
+            return false;
+        }
+        trackState<Command>(index, cmd.command());
+        return true;
+    }
+
+    template <typename Command>
+    bool copyToDisplayList(const std::size_t index, DisplayList& src)
+    {
+        const uint32_t op = *(src.template lookAhead<uint32_t>());
+        if (!addStateFromLog<Command>(index) || !appendCopyToDisplayList<Command>(index, src))
+        {
+            return false;
+        }
+        trackState<Command>(index, op);
+        return true;
+    }
+
+    template <typename Command>
+    bool appendToDisplayList(const std::size_t index, const Command& cmd)
+    {
+        if constexpr (std::is_same<Command, TextureStreamCmd>::value)
+        {
+            for (const uint32_t addr : cmd.payload())
+            {
+                m_texturePages[index].set(TextureStreamCmd::getPageByAddress(addr));
+            }
+        }
+        if (m_displayListAssembler[m_lastSegment[index]].addCommand(cmd))
+        {
+            return true;
+        }
+        return appendSegment(index) && m_displayListAssembler[m_lastSegment[index]].addCommand(cmd);
+    }
+
+    template <typename Command>
+    bool appendCopyToDisplayList(const std::size_t index, DisplayList& src)
+    {
+        if constexpr (std::is_same<Command, TextureStreamCmd>::value)
+        {
+            const std::size_t pages = TextureStreamCmd::getNumberOfElementsInPayloadByCommand(*(src.template lookAhead<uint32_t>()));
+            for (std::size_t i = 0; i < pages; i++)
+            {
+                m_texturePages[index].set(TextureStreamCmd::getPageByAddress(*(src.template lookAhead<uint32_t>(i + 2))));
+            }
+        }
+        if (m_displayListAssembler[m_lastSegment[index]].template copyCommand<Command>(src))
+        {
+            return true;
+        }
+        return appendSegment(index) && m_displayListAssembler[m_lastSegment[index]].template copyCommand<Command>(src);
+    }
+
+    template <typename Command>
+    bool recordState(const Command& cmd)
+    {
+        if constexpr (!singleList() && StateLog::template isStateCommand<Command>())
+        {
+            return m_stateLog && m_stateLog->record(cmd);
+        }
+        return false;
+    }
+
+    StateLog& getStateLog(const std::size_t index)
+    {
+        // The worker which fills the display list owns a copy of the log
+        return m_parallelAssemblyRunning ? m_workerStateLogs[index % m_workers.size()] : *m_stateLog;
+    }
+
+    // Adds the state from the log, which is used by the command and not yet in the display list
+    template <typename Command>
+    bool addStateFromLog(const std::size_t index)
+    {
+        if constexpr (singleList() || StateLog::template isStateCommand<Command>() || std::is_same<Command, NopCmd>::value)
+        {
+            return true;
+        }
+        else
+        {
+            if (!m_stateLog)
+            {
+                return true;
+            }
+            constexpr bool triangle = std::is_same<Command, TriangleStreamCmd>::value || std::is_same<Command, RegularTriangleCmd>::value;
+            StateLog& log = getStateLog(index);
+            StateCursor& cursor = m_stateCursor[index];
+            if ((triangle ? cursor.version : cursor.registerVersion) == log.getVersion())
+            {
+                return true;
+            }
+            const bool ret = log.forEachChangedSlot(cursor.versions, triangle, [this, index, &log](const std::size_t slot)
+                { return addStateSlot(index, log, slot); });
+            if (ret)
+            {
+                cursor.registerVersion = log.getVersion();
+                cursor.version = triangle ? log.getVersion() : cursor.version;
+            }
+            return ret;
+        }
+    }
+
+    bool addStateSlot(const std::size_t index, StateLog& log, const std::size_t slot)
+    {
+        StateCursor& cursor = m_stateCursor[index];
+        const std::size_t segment = m_lastSegment[index];
+        const std::size_t pos = m_displayListAssembler[segment].getDisplayListSize();
+        const bool ret = log.visitCommand(slot, [this, index](auto* command, DisplayList& src)
+            { return appendCopyToDisplayList<std::remove_pointer_t<decltype(command)>>(index, src); });
+        if (!ret)
+        {
+            return false;
+        }
+        if (!cursor.written[slot])
+        {
+            // The first write of the slot might be redundant, see removeRedundantState()
+            const std::size_t lastSegment = m_lastSegment[index];
+            const std::size_t start = (lastSegment == segment) ? pos : 0;
+            const std::size_t end = m_displayListAssembler[lastSegment].getDisplayListSize();
+            if (end > start)
+            {
+                cursor.snapshots[cursor.snapshotCount] = {
+                    static_cast<uint32_t>(slot),
+                    static_cast<uint32_t>(lastSegment),
+                    static_cast<uint32_t>(start),
+                    static_cast<uint32_t>(end - start),
+                    log.getVersion(slot),
+                };
+                cursor.snapshotCount++;
+            }
+        }
+        cursor.versions[slot] = log.getVersion(slot);
+        cursor.written.set(slot);
+        cursor.direct.reset(slot);
+        return true;
+    }
+
+    // State which is directly added to a display list replaces the state from the log
+    template <typename Command>
+    void trackState(const std::size_t index, const uint32_t op)
+    {
+        if constexpr (!singleList() && StateLog::template isStateCommand<Command>())
+        {
+            const std::size_t slot = StateLog::template getSlot<Command>(op);
+            if (!m_stateLog || (slot == StateLog::NO_SLOT))
+            {
+                return;
+            }
+            StateCursor& cursor = m_stateCursor[index];
+            cursor.versions[slot] = getStateLog(index).getVersion(slot);
+            cursor.written.set(slot);
+            cursor.direct.set(slot);
+        }
+    }
+
+    // Links a free segment to the end of a full display list. The segments of a display list are streamed
+    // back to back, so the hardware sees one continuous display list. Single lists are using the intermediate
+    // upload instead. Thread safe for workers which are filling different display lists.
+    bool appendSegment(const std::size_t index)
+    {
+        const std::size_t segment = m_usedSegments.fetch_add(1, std::memory_order_relaxed);
+        if (segment >= m_overflowSegments)
+        {
+            return false;
+        }
+        const std::size_t assembler = RenderConfig::getDisplayLines() + segment;
+        m_displayListAssembler[assembler].clearAssembler();
+        m_nextSegment[m_lastSegment[index]] = assembler;
+        m_lastSegment[index] = assembler;
+        return true;
+    }
+
+    void resetSegments()
+    {
+        m_nextSegment.fill(NO_SEGMENT);
+        for (std::size_t i = 0; i < m_lastSegment.size(); i++)
+        {
+            m_lastSegment[i] = i;
+        }
+        m_usedSegments = 0;
+    }
+
+    template <typename TriangleCmd>
+    bool addTriangleCommand(const std::size_t index, TriangleCmd& triangleCmd)
+    {
+        // The floating point rasterizer can automatically increment all attributes
+        if constexpr (RenderConfig::USE_FLOAT_INTERPOLATION)
+        {
+            return addToDisplayList(index, triangleCmd);
+        }
+        else
+        {
+            const std::size_t currentScreenPositionStart = index * m_yLineResolution;
+            const std::size_t currentScreenPositionEnd = currentScreenPositionStart + m_yLineResolution;
+            return addToDisplayList(index, triangleCmd.getIncremented(currentScreenPositionStart, currentScreenPositionEnd));
+        }
+    }
+
+    bool runWorker(const std::size_t worker)
+    {
+        typename CommandQueue::EntryHeader header {};
+        DisplayList src {};
+        while (m_commandQueue->fetch(worker, header, src))
+        {
+            if ((header.target == CommandQueue::TARGET_ALL) && m_stateLog)
+            {
+                src.resetGet();
+                if (m_workerStateLogs[worker].recordAny(src))
+                {
+                    m_commandQueue->pop(worker, header);
+                    continue;
+                }
+            }
+            for (std::size_t i = worker; i < m_displayLines; i += m_workers.size())
+            {
+                const bool bin = header.target == CommandQueue::TARGET_BIN;
+                if ((header.target == CommandQueue::TARGET_ALL)
+                    || (header.target == i)
+                    || (bin && (i >= header.firstLine) && (i <= header.lastLine)))
+                {
+                    src.resetGet();
+                    if (!copyQueuedCommand(i, src, bin))
+                    {
+                        SPDLOG_ERROR("Display list {} is full. Command is dropped.", i);
+                        m_assemblyFailed.store(true, std::memory_order_relaxed);
+                    }
+                }
+            }
+            m_commandQueue->pop(worker, header);
+        }
+        return true;
+    }
+
+    // A worker could not add a command to a full display list. The workers are running behind the producer,
+    // therefore the failure is reported with the next command which the producer adds.
+    bool assemblyFailed() const
+    {
+        return m_assemblyFailed.load(std::memory_order_relaxed);
+    }
+
+    bool copyQueuedCommand(const std::size_t index, DisplayList& src, const bool bin)
+    {
+        const uint32_t op = *(src.template lookAhead<uint32_t>());
+        if (TriangleStreamCmd::isThis(op))
+        {
+            if (bin)
+            {
+                src.template getNext<typename TriangleStreamCmd::CommandType>();
+                TriangleStreamCmd cmd { *(src.template getNext<typename TriangleStreamCmd::PayloadType::value_type>()) };
+                return addTriangleCommand(index, cmd);
+            }
+            return copyToDisplayList<TriangleStreamCmd>(index, src);
+        }
+        else if (RegularTriangleCmd::isThis(op))
+        {
+            if (bin)
+            {
+                src.template getNext<typename RegularTriangleCmd::CommandType>();
+                RegularTriangleCmd cmd { *(src.template getNext<typename RegularTriangleCmd::PayloadType::value_type>()) };
+                return addTriangleCommand(index, cmd);
+            }
+            return copyToDisplayList<RegularTriangleCmd>(index, src);
+        }
+        else if (WriteRegisterCmd<BaseColorReg>::isThis(op))
+        {
+            return copyToDisplayList<WriteRegisterCmd<BaseColorReg>>(index, src);
+        }
+        else if (TextureStreamCmd::isThis(op))
+        {
+            return copyToDisplayList<TextureStreamCmd>(index, src);
+        }
+        else if (FramebufferCmd::isThis(op))
+        {
+            return copyToDisplayList<FramebufferCmd>(index, src);
+        }
+        else if (FogLutStreamCmd::isThis(op))
+        {
+            return copyToDisplayList<FogLutStreamCmd>(index, src);
+        }
+        else if (NopCmd::isThis(op))
+        {
+            return copyToDisplayList<NopCmd>(index, src);
+        }
+        SPDLOG_CRITICAL("Unknown command (0x{:X}) found in the command queue.", op);
+        return true;
+    }
+
+    // Calculates the first and the last display list which are covered by the lines and counts the skipped
+    // display lists. Returns false if no display list is covered.
+    bool coveredDisplayLists(const std::size_t lineStart, const std::size_t lineEnd, std::size_t& firstLine, std::size_t& lastLine)
+    {
+        firstLine = lineStart / m_yLineResolution;
+        lastLine = (std::min)(lineEnd / m_yLineResolution, m_displayLines - 1);
+        if (firstLine > lastLine)
+        {
+            m_skippedDisplayListInserts += m_displayLines;
+            return false;
+        }
+        m_skippedDisplayListInserts += m_displayLines - (lastLine - firstLine + 1);
+        return true;
+    }
+
     std::size_t reverseDisplayListIndex(const std::size_t i) const
     {
         // Reverse the order of the display list to get a continuous stream from the internal framebuffer to a
@@ -167,7 +736,29 @@ private:
     std::size_t m_yLineResolution { 128 };
     std::size_t m_xResolution { 640 };
     std::size_t m_displayLines { RenderConfig::getDisplayLines() };
+    std::size_t m_skippedDisplayListInserts { 0 };
     TDisplayListAssembler& m_displayListAssembler;
+
+    // Chained segments. The first display lines are the heads of the display lists, the remaining assemblers
+    // are linked to the display lists which are running out of space.
+    std::array<std::size_t, SEGMENT_COUNT> m_nextSegment {};
+    std::array<std::size_t, RenderConfig::getDisplayLines()> m_lastSegment {};
+    std::atomic<std::size_t> m_usedSegments { 0 };
+    std::size_t m_overflowSegments { 0 };
+
+    // Lazy state
+    StateLog* m_stateLog { nullptr };
+    tcb::span<StateLog> m_workerStateLogs {};
+    std::array<StateCursor, RenderConfig::getDisplayLines()> m_stateCursor;
+
+    // Texture dependencies
+    std::array<TexturePages, RenderConfig::getDisplayLines()> m_texturePages {};
+
+    // Parallel assembly
+    CommandQueue* m_commandQueue { nullptr };
+    tcb::span<IThreadRunner* const> m_workers {};
+    bool m_parallelAssemblyRunning { false };
+    std::atomic<bool> m_assemblyFailed { false };
 };
 
 } // namespace rr::displaylist
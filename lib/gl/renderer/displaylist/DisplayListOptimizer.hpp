@@ -0,0 +1,212 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef DISPLAYLISTOPTIMIZER_HPP
+#define DISPLAYLISTOPTIMIZER_HPP
+
+#include "RenderConfigs.hpp"
+#include "renderer/commands/FogLutStreamCmd.hpp"
+#include "renderer/commands/PushVertexBatchCmd.hpp"
+#include "renderer/commands/PushVertexCmd.hpp"
+#include "renderer/commands/SetVertexCtxCmd.hpp"
+#include "renderer/commands/TextureStreamCmd.hpp"
+#include "renderer/commands/WriteRegisterCmd.hpp"
+#include <algorithm>
+#include <array>
+#include <stdint.h>
+#include <tuple>
+#include <type_traits>
+
+namespace rr::displaylist
+{
+// Peephole optimizer for display lists. Every command is shown to the passes before and after it is
+// added to the display list. A pass can drop a new command, eliminate a previous command or modify a
+// previous command in place. Eliminated commands are overwritten with NOPs, so the display list stays
+// valid at any time. When the display list is finished, the eliminated commands are removed
+// from the display list (compaction).
+//
+// A pass has to provide the following interface:
+//   void reset();
+//   // Called before the command is added. Returns false when the command shall be dropped.
+//   template <typename TCommand, typename TOptimizer>
+//   bool filter(const typename TOptimizer::CommandInfo& cmd, TOptimizer& optimizer);
+//   // Called after the command was added to the display list.
+//   template <typename TCommand, typename TOptimizer>
+//   void added(const typename TOptimizer::CommandInfo& cmd, TOptimizer& optimizer);
+template <typename TDisplayList, typename... TPasses>
+class DisplayListOptimizer
+{
+public:
+    struct CommandInfo
+    {
+        uint32_t op; // The op of the command
+        uint32_t value; // First word of the payload (only valid for register writes)
+        std::size_t pos; // Position of the command in the display list
+        std::size_t size; // Size of the command including the payload
+    };
+
+    DisplayListOptimizer(TDisplayList& displayList)
+        : m_displayList { displayList }
+    {
+    }
+
+    void reset()
+    {
+        m_eliminatedAreaCount = 0;
+        m_lastConsumerEnd = 0;
+        std::apply([](auto&... pass)
+            { (pass.reset(), ...); },
+            m_passes);
+    }
+
+    template <typename TCommand>
+    bool filter(const CommandInfo& cmd)
+    {
+        return std::apply([&](auto&... pass)
+            { return (pass.template filter<TCommand>(cmd, *this) && ...); },
+            m_passes);
+    }
+
+    template <typename TCommand>
+    void added(const CommandInfo& cmd)
+    {
+        if constexpr (!isStateCommand<TCommand>())
+        {
+            m_lastConsumerEnd = cmd.pos + cmd.size;
+        }
+        std::apply([&](auto&... pass)
+            { (pass.template added<TCommand>(cmd, *this), ...); },
+            m_passes);
+    }
+
+    // Commands which are only changing the state of the hardware. All other commands are consuming the state.
+    template <typename TCommand>
+    static constexpr bool isStateCommand()
+    {
+        return IsWriteRegisterCmd<TCommand>::value
+            || std::is_same<TCommand, TextureStreamCmd>::value
+            || std::is_same<TCommand, FogLutStreamCmd>::value;
+    }
+
+    template <typename TCommand>
+    static constexpr bool isRegisterWrite()
+    {
+        return IsWriteRegisterCmd<TCommand>::value;
+    }
+
+    // Commands which are executed by the threaded rasterizer. The vertex transformation of the threaded
+    // rasterizer writes the stencil config of the two sided stencil directly into its output.
+    template <typename TCommand>
+    static constexpr bool isVertexCommand()
+    {
+        return std::is_same<TCommand, SetVertexCtxCmd>::value
+            || std::is_same<TCommand, PushVertexCmd>::value
+            || std::is_same<TCommand, PushVertexBatchCmd>::value;
+    }
+
+    // Interface for the passes
+
+    void eliminate(const std::size_t pos, const std::size_t size)
+    {
+        m_displayList.initArea(pos, size);
+        if (m_eliminatedAreaCount < m_eliminatedAreas.size())
+        {
+            m_eliminatedAreas[m_eliminatedAreaCount] = { static_cast<uint32_t>(pos), static_cast<uint32_t>(size) };
+            m_eliminatedAreaCount++;
+        }
+        // Otherwise the command stays as NOP in the display list
+    }
+
+    template <typename TCommandType>
+    TCommandType* getCommand(const std::size_t pos)
+    {
+        return m_displayList.template getAt<TCommandType>(pos);
+    }
+
+    std::size_t getWritePos() const
+    {
+        return m_displayList.getCurrentWritePos();
+    }
+
+    // Interface for the display list assembler
+
+    // Position behind the last command which consumes the state
+    std::size_t getLastConsumerEnd() const
+    {
+        return m_lastConsumerEnd;
+    }
+
+    // Removes the eliminated commands from the display list
+    void compact()
+    {
+        if (m_eliminatedAreaCount == 0)
+        {
+            return;
+        }
+        std::sort(m_eliminatedAreas.begin(), m_eliminatedAreas.begin() + m_eliminatedAreaCount,
+            [](const Area& a, const Area& b)
+            { return a.pos < b.pos; });
+
+        const std::size_t size = m_displayList.getSize();
+        std::size_t dst = m_eliminatedAreas[0].pos;
+        std::size_t src = dst;
+        for (std::size_t i = 0; (i < m_eliminatedAreaCount) && (m_eliminatedAreas[i].pos < size); i++)
+        {
+            const Area& area = m_eliminatedAreas[i];
+            if (area.pos > src)
+            {
+                m_displayList.moveArea(dst, src, area.pos - src);
+                dst += area.pos - src;
+            }
+            src = area.pos + area.size;
+        }
+        if (src < size)
+        {
+            m_displayList.moveArea(dst, src, size - src);
+            dst += size - src;
+        }
+        m_displayList.setCurrentSize((std::min)(dst, size));
+        m_eliminatedAreaCount = 0;
+    }
+
+private:
+    struct Area
+    {
+        uint32_t pos;
+        uint32_t size;
+    };
+
+    template <typename TCommand>
+    struct IsWriteRegisterCmd : std::false_type
+    {
+    };
+
+    template <typename TRegister>
+    struct IsWriteRegisterCmd<WriteRegisterCmd<TRegister>> : std::true_type
+    {
+    };
+
+    TDisplayList& m_displayList;
+    std::tuple<TPasses...> m_passes {};
+    std::array<Area, RenderConfig::DISPLAY_LIST_OPTIMIZER_MAX_ELIMINATED_COMMANDS> m_eliminatedAreas;
+    std::size_t m_eliminatedAreaCount { 0 };
+    std::size_t m_lastConsumerEnd { 0 };
+};
+
+} // namespace rr::displaylist
+
+#endif // DISPLAYLISTOPTIMIZER_HPP
@@ -0,0 +1,164 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef DISPLAYLISTRING_HPP
+#define DISPLAYLISTRING_HPP
+
+#include "WaitCondition.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <stdint.h>
+
+namespace rr::displaylist
+{
+
+// Ring of display list sets which are handed over from one producer (the thread which records the frames)
+// to one consumer (the thread which uploads them). The producer always records into the back. With swap()
+// the back is queued and the next set becomes the back. publish() makes the queued sets visible to the
+// consumer, which uploads the front and returns it with release().
+// The number of queued sets is limited by the frames in flight. swap() blocks when the limit is reached.
+// By default one frame is in flight, which is the behaviour of a plain double buffer. More frames absorb
+// jitter of the upload, but every further frame adds one frame of latency.
+template <typename TDisplayList, std::size_t MAX_DEPTH>
+class DisplayListRing
+{
+    static_assert(MAX_DEPTH >= 2, "The ring requires at least two display list sets");
+
+public:
+    DisplayListRing(std::array<TDisplayList, MAX_DEPTH>& displayLists)
+        : m_displayLists { displayLists }
+    {
+    }
+
+    // Sets the number of used display list sets. Must only be called when no set is queued.
+    void setDepth(const std::size_t depth)
+    {
+        m_depth = std::clamp(depth, static_cast<std::size_t>(2), MAX_DEPTH);
+        m_submitted = 0;
+        m_published = 0;
+        m_released = 0;
+        setMaxFramesInFlight(m_maxFramesInFlight);
+    }
+
+    std::size_t getDepth() const
+    {
+        return m_depth;
+    }
+
+    void setMaxFramesInFlight(const std::size_t frames)
+    {
+        m_maxFramesInFlight = std::clamp(frames, static_cast<std::size_t>(1), m_depth - 1);
+    }
+
+    std::size_t getMaxFramesInFlight() const
+    {
+        return m_maxFramesInFlight;
+    }
+
+    TDisplayList& getBack()
+    {
+        return m_displayLists[getBackIndex()];
+    }
+
+    TDisplayList& getFront()
+    {
+        return m_displayLists[getFrontIndex()];
+    }
+
+    // The indices can be used to attach further data to the sets
+    std::size_t getBackIndex() const
+    {
+        return m_submitted.load(std::memory_order_relaxed) % m_depth;
+    }
+
+    std::size_t getFrontIndex() const
+    {
+        return m_released.load(std::memory_order_relaxed) % m_depth;
+    }
+
+    TDisplayList& get(const std::size_t index)
+    {
+        return m_displayLists[index];
+    }
+
+    // Producer: Queues the back and selects the next set as back. Waits till the next set is uploaded.
+    void swap()
+    {
+        const std::size_t submitted = m_submitted.load(std::memory_order_relaxed);
+        m_waitCondition.wait([&]()
+            { return (submitted - m_released.load()) < m_maxFramesInFlight; });
+        m_submitted.store(submitted + 1, std::memory_order_relaxed);
+    }
+
+    // Producer: Hands the queued sets over to the consumer.
+    // Returns true if the consumer is not running and must be started by the caller.
+    bool publish()
+    {
+        m_published.store(m_submitted.load(std::memory_order_relaxed));
+        return tryStartConsumer();
+    }
+
+    // Producer: Waits till all published sets are uploaded.
+    void waitTillIdle()
+    {
+        m_waitCondition.wait([&]()
+            { return (m_released.load() >= m_published.load()) && !m_consumerActive.load(); });
+    }
+
+    // Consumer: Returns the uploaded front to the producer.
+    // Returns true if another published set is waiting in the front. Otherwise the consumer must stop.
+    bool release()
+    {
+        const std::size_t released = m_released.fetch_add(1) + 1;
+        if (released < m_published.load())
+        {
+            m_waitCondition.notify();
+            return true;
+        }
+        m_consumerActive.store(false);
+        m_waitCondition.notify();
+        // The producer might have published a set after the check above but still seen the consumer as active
+        return tryStartConsumer();
+    }
+
+private:
+    bool tryStartConsumer()
+    {
+        if (m_released.load() >= m_published.load())
+        {
+            return false;
+        }
+        bool expected = false;
+        return m_consumerActive.compare_exchange_strong(expected, true);
+    }
+
+    std::array<TDisplayList, MAX_DEPTH>& m_displayLists;
+    std::size_t m_depth { MAX_DEPTH };
+    std::size_t m_maxFramesInFlight { 1 };
+
+    // Monotonic counters. The index of a set is the counter modulo the depth.
+    std::atomic<std::size_t> m_submitted { 0 };
+    std::atomic<std::size_t> m_published { 0 };
+    std::atomic<std::size_t> m_released { 0 };
+    std::atomic<bool> m_consumerActive { false };
+
+    WaitCondition m_waitCondition {};
+};
+
+} // namespace rr::displaylist
+#endif // DISPLAYLISTRING_HPP
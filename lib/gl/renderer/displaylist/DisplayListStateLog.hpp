@@ -0,0 +1,259 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef DISPLAYLISTSTATELOG_HPP
+#define DISPLAYLISTSTATELOG_HPP
+
+#include "DisplayList.hpp"
+#include "RIXDisplayListAssembler.hpp"
+#include "renderer/commands/FogLutStreamCmd.hpp"
+#include "renderer/commands/TextureStreamCmd.hpp"
+#include "renderer/commands/WriteRegisterCmd.hpp"
+#include "renderer/registers/BaseColorReg.hpp"
+#include <algorithm>
+#include <array>
+#include <stdint.h>
+#include <type_traits>
+
+namespace rr::displaylist
+{
+
+// Log of the state commands which are valid for all display lists. Instead of copying a state command into
+// every display list, it is recorded once here and only added to a display list when this display list uses
+// the state. The log only keeps the latest command of every slot (a register, the texture of a TMU or the
+// fog LUT), therefore it has a fixed size. Every slot has a version, which is incremented with every recorded
+// command, so a display list can find out which slots are changed since it has seen the log the last time.
+template <std::size_t TMU_COUNT>
+class DisplayListStateLog
+{
+    static constexpr std::size_t REGISTER_COUNT { 32 };
+    static constexpr std::size_t TEXTURE_SLOT { REGISTER_COUNT };
+    static constexpr std::size_t FOG_LUT_SLOT { TEXTURE_SLOT + TMU_COUNT };
+
+public:
+    static constexpr std::size_t SLOT_COUNT { FOG_LUT_SLOT + 1 };
+    static constexpr std::size_t NO_SLOT { SLOT_COUNT };
+    static constexpr uint64_t UNKNOWN_VERSION { 0 };
+    using Versions = std::array<uint64_t, SLOT_COUNT>;
+
+    // Commands which are only changing the state of the hardware
+    template <typename TCommand>
+    static constexpr bool isStateCommand()
+    {
+        return IsWriteRegisterCmd<TCommand>::value
+            || std::is_same<TCommand, TextureStreamCmd>::value
+            || std::is_same<TCommand, FogLutStreamCmd>::value;
+    }
+
+    // Returns the slot of a state command or NO_SLOT if the command can't be logged
+    template <typename TCommand>
+    static std::size_t getSlot(const uint32_t op)
+    {
+        if constexpr (IsWriteRegisterCmd<TCommand>::value)
+        {
+            const std::size_t addr = WriteRegisterCmd<BaseColorReg>::getRegAddr(op);
+            return (addr < REGISTER_COUNT) ? addr : NO_SLOT;
+        }
+        else if constexpr (std::is_same<TCommand, TextureStreamCmd>::value)
+        {
+            const std::size_t tmu = TextureStreamCmd::getTmuByCommand(op);
+            return (tmu < TMU_COUNT) ? TEXTURE_SLOT + tmu : NO_SLOT;
+        }
+        else if constexpr (std::is_same<TCommand, FogLutStreamCmd>::value)
+        {
+            return FOG_LUT_SLOT;
+        }
+        return NO_SLOT;
+    }
+
+    // Slots which are only used by triangles. All other slots are also used by the framebuffer commands.
+    static constexpr bool isTriangleState(const std::size_t slot)
+    {
+        return slot >= TEXTURE_SLOT;
+    }
+
+    template <typename TCommand>
+    bool record(const TCommand& cmd)
+    {
+        const std::size_t slot = getSlot<TCommand>(cmd.command());
+        if (slot == NO_SLOT)
+        {
+            return false;
+        }
+        DisplayList dst = getSlotWriter(slot);
+        if (!RIXDisplayListAssembler<DisplayList> { dst }.addCommand(cmd))
+        {
+            return false;
+        }
+        updateSlot(slot, dst.getSize());
+        return true;
+    }
+
+    // Records a command from a display list. The command is consumed from src on success.
+    template <typename TCommand>
+    bool record(DisplayList& src)
+    {
+        const std::size_t slot = getSlot<TCommand>(*(src.template lookAhead<typename TCommand::CommandType>()));
+        if (slot == NO_SLOT)
+        {
+            return false;
+        }
+        DisplayList dst = getSlotWriter(slot);
+        if (!RIXDisplayListAssembler<DisplayList> { dst }.template copyCommand<TCommand>(src))
+        {
+            return false;
+        }
+        updateSlot(slot, dst.getSize());
+        return true;
+    }
+
+    // Records a command from a display list, when it is a state command. Returns false otherwise.
+    bool recordAny(DisplayList& src)
+    {
+        const uint32_t op = *(src.template lookAhead<uint32_t>());
+        if (WriteRegisterCmd<BaseColorReg>::isThis(op))
+        {
+            return record<WriteRegisterCmd<BaseColorReg>>(src);
+        }
+        else if (TextureStreamCmd::isThis(op))
+        {
+            return record<TextureStreamCmd>(src);
+        }
+        else if (FogLutStreamCmd::isThis(op))
+        {
+            return record<FogLutStreamCmd>(src);
+        }
+        return false;
+    }
+
+    // Version of the last recorded command
+    uint64_t getVersion() const
+    {
+        return m_version;
+    }
+
+    uint64_t getVersion(const std::size_t slot) const
+    {
+        return m_versions[slot];
+    }
+
+    // Calls func(slot) for every slot which is newer than the given versions, in the order in which the
+    // commands were recorded. Triangle state is only visited when includeTriangleState is set.
+    template <typename Function>
+    bool forEachChangedSlot(const Versions& versions, const bool includeTriangleState, const Function& func) const
+    {
+        std::array<uint8_t, SLOT_COUNT> slots;
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < SLOT_COUNT; i++)
+        {
+            if ((m_versions[i] != versions[i]) && (includeTriangleState || !isTriangleState(i)))
+            {
+                slots[count] = static_cast<uint8_t>(i);
+                count++;
+            }
+        }
+        std::sort(slots.begin(), slots.begin() + count, [this](const uint8_t a, const uint8_t b)
+            { return m_versions[a] < m_versions[b]; });
+        bool ret = true;
+        for (std::size_t i = 0; ret && (i < count); i++)
+        {
+            ret = func(slots[i]);
+        }
+        return ret;
+    }
+
+    // Calls func(static_cast<TCommand*>(nullptr), src) with the command of a slot. src is a display list
+    // which contains only this command.
+    template <typename Function>
+    bool visitCommand(const std::size_t slot, const Function& func)
+    {
+        DisplayList src {};
+        src.setBuffer(getSlotBuffer(slot));
+        src.setCurrentSize(m_sizes[slot]);
+        if (slot < TEXTURE_SLOT)
+        {
+            return func(static_cast<WriteRegisterCmd<BaseColorReg>*>(nullptr), src);
+        }
+        else if (slot < FOG_LUT_SLOT)
+        {
+            return func(static_cast<TextureStreamCmd*>(nullptr), src);
+        }
+        return func(static_cast<FogLutStreamCmd*>(nullptr), src);
+    }
+
+    // Versions of the slots which the hardware holds after the last executed display list. It is used to
+    // remove the state from the display lists, which the hardware already has.
+    Versions& getResidentVersions()
+    {
+        return m_residentVersions;
+    }
+
+private:
+    template <typename TCommand>
+    struct IsWriteRegisterCmd : std::false_type
+    {
+    };
+
+    template <typename TRegister>
+    struct IsWriteRegisterCmd<WriteRegisterCmd<TRegister>> : std::true_type
+    {
+    };
+
+    // Size of a slot buffer. The assembler requires one additional byte.
+    static constexpr std::size_t getSlotSize(const std::size_t payloadSize)
+    {
+        return (DisplayList::template sizeOf<uint32_t>() * (payloadSize + 1)) + 1;
+    }
+
+    tcb::span<uint8_t> getSlotBuffer(const std::size_t slot)
+    {
+        if (slot < TEXTURE_SLOT)
+        {
+            return m_registers[slot];
+        }
+        else if (slot < FOG_LUT_SLOT)
+        {
+            return m_textures[slot - TEXTURE_SLOT];
+        }
+        return m_fogLut;
+    }
+
+    DisplayList getSlotWriter(const std::size_t slot)
+    {
+        DisplayList dst {};
+        dst.setBuffer(getSlotBuffer(slot));
+        return dst;
+    }
+
+    void updateSlot(const std::size_t slot, const std::size_t size)
+    {
+        m_version++;
+        m_versions[slot] = m_version;
+        m_sizes[slot] = size;
+    }
+
+    std::array<std::array<uint8_t, getSlotSize(1)>, REGISTER_COUNT> m_registers {};
+    std::array<std::array<uint8_t, getSlotSize(TextureStreamCmd::getMaxNumberOfElementsInPayload())>, TMU_COUNT> m_textures {};
+    std::array<uint8_t, getSlotSize(std::tuple_size<FogLutStreamCmd::PayloadType>::value)> m_fogLut {};
+    std::array<std::size_t, SLOT_COUNT> m_sizes {};
+    Versions m_versions {};
+    Versions m_residentVersions {};
+    uint64_t m_version { UNKNOWN_VERSION };
+};
+
+} // namespace rr::displaylist
+#endif // DISPLAYLISTSTATELOG_HPP
@@ -0,0 +1,137 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef REGISTERWRITEOPTIMIZER_HPP
+#define REGISTERWRITEOPTIMIZER_HPP
+
+#include "renderer/registers/StencilReg.hpp"
+#include <array>
+#include <bitset>
+#include <stdint.h>
+
+namespace rr::displaylist
+{
+// Optimizer pass for register writes. It keeps a shadow of the register values.
+// - A write of a value, which the register already holds, is redundant and is dropped.
+// - A write which is overwritten before a command has consumed it, is eliminated.
+// The state of the registers at the beginning of a display list is unknown. Therefore the shadow
+// must be reset when the display list is cleared.
+// The threaded rasterizer writes the stencil register while it executes the vertex commands. These writes
+// are not visible in this display list, therefore the vertex commands invalidate the shadow of the stencil register.
+class RegisterWriteOptimizer
+{
+public:
+    void reset()
+    {
+        m_valid.reset();
+        m_pending.reset();
+    }
+
+    template <typename TCommand, typename TOptimizer>
+    bool filter(const typename TOptimizer::CommandInfo& cmd, TOptimizer& optimizer)
+    {
+        if constexpr (TOptimizer::template isRegisterWrite<TCommand>())
+        {
+            const uint32_t addr = TCommand::getRegAddr(cmd.op);
+            if (addr >= MAX_REGISTERS)
+            {
+                return true;
+            }
+            if (m_pending[addr])
+            {
+                if (m_pendingWrites[addr].value == cmd.value)
+                {
+                    return false;
+                }
+                if (m_valid[addr] && (m_values[addr] == cmd.value))
+                {
+                    // The pending write is reverted before it was used
+                    optimizer.eliminate(m_pendingWrites[addr].pos, m_pendingWrites[addr].size);
+                    m_pending.reset(addr);
+                    return false;
+                }
+                return true;
+            }
+            return !(m_valid[addr] && (m_values[addr] == cmd.value));
+        }
+        return true;
+    }
+
+    template <typename TCommand, typename TOptimizer>
+    void added(const typename TOptimizer::CommandInfo& cmd, TOptimizer& optimizer)
+    {
+        if constexpr (TOptimizer::template isRegisterWrite<TCommand>())
+        {
+            const uint32_t addr = TCommand::getRegAddr(cmd.op);
+            if (addr >= MAX_REGISTERS)
+            {
+                return;
+            }
+            if (m_pending[addr])
+            {
+                optimizer.eliminate(m_pendingWrites[addr].pos, m_pendingWrites[addr].size);
+            }
+            m_pending.set(addr);
+            m_pendingWrites[addr] = { cmd.value, static_cast<uint32_t>(cmd.pos), static_cast<uint32_t>(cmd.size) };
+        }
+        else if constexpr (!TOptimizer::template isStateCommand<TCommand>())
+        {
+            if (m_pending.any())
+            {
+                commitPendingWrites();
+            }
+            if constexpr (TOptimizer::template isVertexCommand<TCommand>())
+            {
+                m_valid.reset(StencilReg {}.getAddr());
+            }
+        }
+    }
+
+private:
+    static constexpr std::size_t MAX_REGISTERS { 32 };
+
+    struct PendingWrite
+    {
+        uint32_t value;
+        uint32_t pos;
+        uint32_t size;
+    };
+
+    void commitPendingWrites()
+    {
+        for (std::size_t i = 0; i < MAX_REGISTERS; i++)
+        {
+            if (m_pending[i])
+            {
+                m_values[i] = m_pendingWrites[i].value;
+            }
+        }
+        m_valid |= m_pending;
+        m_pending.reset();
+    }
+
+    // Values of the registers which are seen by the consuming commands
+    std::bitset<MAX_REGISTERS> m_valid {};
+    std::array<uint32_t, MAX_REGISTERS> m_values {};
+    // Writes which are not yet consumed by a command
+    std::bitset<MAX_REGISTERS> m_pending {};
+    std::array<PendingWrite, MAX_REGISTERS> m_pendingWrites {};
+};
+
+} // namespace rr::displaylist
+
+#endif // REGISTERWRITEOPTIMIZER_HPP
@@ -0,0 +1,183 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef SHAREDCOMMANDQUEUE_HPP
+#define SHAREDCOMMANDQUEUE_HPP
+
+#include "DisplayList.hpp"
+#include "RIXDisplayListAssembler.hpp"
+#include "WaitCondition.hpp"
+#include <array>
+#include <atomic>
+#include <stdint.h>
+#include <tcb/span.hpp>
+
+namespace rr::displaylist
+{
+
+// Lock-free ring buffer with one producer and several readers. Every reader sees every entry.
+// An entry consists of a header, which describes for which display lists the command is meant,
+// and the serialized command. The producer only overwrites an entry when all readers have
+// passed it. Entries never wrap around the end of the buffer. The positions are atomics, therefore no lock is
+// taken as long as no side has to wait. A waiting side waits on the WaitCondition.
+template <std::size_t MAX_READERS>
+class SharedCommandQueue
+{
+public:
+    static constexpr uint32_t TARGET_ALL { 0xFFFF'FFFF };
+    static constexpr uint32_t TARGET_BIN { 0xFFFF'FFFE };
+    static constexpr uint32_t TARGET_WRAP { 0xFFFF'FFFD };
+
+    struct EntryHeader
+    {
+#pragma pack(push, 4)
+        uint32_t target; // Index of the display list, TARGET_ALL or TARGET_BIN
+        uint32_t size; // Size of the entry in bytes including this header
+        uint32_t firstLine; // First display list of a TARGET_BIN entry
+        uint32_t lastLine; // Last display list of a TARGET_BIN entry
+#pragma pack(pop)
+    };
+
+    void setBuffer(tcb::span<uint8_t> buffer)
+    {
+        m_buffer = buffer;
+    }
+
+    // Must only be called when no reader is active
+    void reset(const std::size_t readers)
+    {
+        m_readers = readers;
+        m_writePos.store(0);
+        for (std::size_t i = 0; i < m_readPos.size(); i++)
+        {
+            m_readPos[i].store(0);
+        }
+        m_closed.store(false);
+    }
+
+    // Interface for the producer
+
+    template <typename TCommand>
+    bool push(const uint32_t target, const uint32_t firstLine, const uint32_t lastLine, const TCommand& cmd)
+    {
+        const std::size_t size = DisplayList::sizeOf<EntryHeader>() + RIXDisplayListAssembler<DisplayList>::getCommandSize(cmd);
+        if (size >= m_buffer.size())
+        {
+            return false;
+        }
+
+        std::size_t writePos = m_writePos.load(std::memory_order_relaxed);
+        if ((getOffset(writePos) + size) >= m_buffer.size())
+        {
+            // Entries are always contiguous. Skip the rest of the buffer.
+            const std::size_t rest = m_buffer.size() - getOffset(writePos);
+            waitForSpace(writePos, rest);
+            if (rest >= DisplayList::sizeOf<EntryHeader>())
+            {
+                *reinterpret_cast<EntryHeader*>(&m_buffer[getOffset(writePos)]) = { TARGET_WRAP, static_cast<uint32_t>(rest), 0, 0 };
+            }
+            writePos += rest;
+            m_writePos.store(writePos);
+            m_waitCondition.notify();
+        }
+
+        waitForSpace(writePos, size);
+        DisplayList entry {};
+        entry.setBuffer(tcb::span<uint8_t> { m_buffer }.subspan(getOffset(writePos)));
+        *(entry.template create<EntryHeader>()) = { target, static_cast<uint32_t>(size), firstLine, lastLine };
+        RIXDisplayListAssembler<DisplayList> { entry }.addCommand(cmd);
+        m_writePos.store(writePos + size);
+        m_waitCondition.notify();
+        return true;
+    }
+
+    // Signals the readers that no more entries will be pushed
+    void close()
+    {
+        m_closed.store(true);
+        m_waitCondition.notify();
+    }
+
+    // Interface for the readers
+
+    // Waits for the next entry. Returns false when the queue is closed and all entries are read.
+    bool fetch(const std::size_t reader, EntryHeader& header, DisplayList& cmd)
+    {
+        std::size_t readPos = m_readPos[reader].load(std::memory_order_relaxed);
+        while (true)
+        {
+            m_waitCondition.wait([&]()
+                { return (readPos != m_writePos.load()) || m_closed.load(); });
+            if (readPos == m_writePos.load())
+            {
+                // Closed and all entries are read
+                return false;
+            }
+
+            const std::size_t offset = getOffset(readPos);
+            const std::size_t rest = m_buffer.size() - offset;
+            if ((rest < DisplayList::sizeOf<EntryHeader>())
+                || (reinterpret_cast<const EntryHeader*>(&m_buffer[offset])->target == TARGET_WRAP))
+            {
+                readPos += rest;
+                m_readPos[reader].store(readPos);
+                m_waitCondition.notify();
+                continue;
+            }
+
+            header = *reinterpret_cast<const EntryHeader*>(&m_buffer[offset]);
+            const std::size_t headerSize = DisplayList::sizeOf<EntryHeader>();
+            cmd.setBuffer({ &m_buffer[offset + headerSize], header.size - headerSize });
+            cmd.setCurrentSize(header.size - headerSize);
+            cmd.resetGet();
+            return true;
+        }
+    }
+
+    // Releases the entry returned by fetch()
+    void pop(const std::size_t reader, const EntryHeader& header)
+    {
+        const std::size_t readPos = m_readPos[reader].load(std::memory_order_relaxed);
+        m_readPos[reader].store(readPos + header.size);
+        m_waitCondition.notify();
+    }
+
+private:
+    std::size_t getOffset(const std::size_t pos) const
+    {
+        return pos % m_buffer.size();
+    }
+
+    void waitForSpace(const std::size_t writePos, const std::size_t size)
+    {
+        for (std::size_t i = 0; i < m_readers; i++)
+        {
+            m_waitCondition.wait([&]()
+                { return (writePos + size - m_readPos[i].load()) <= m_buffer.size(); });
+        }
+    }
+
+    tcb::span<uint8_t> m_buffer {};
+    std::size_t m_readers { 0 };
+    std::atomic<std::size_t> m_writePos { 0 };
+    std::array<std::atomic<std::size_t>, MAX_READERS> m_readPos {};
+    std::atomic<bool> m_closed { false };
+    WaitCondition m_waitCondition {};
+};
+
+} // namespace rr::displaylist
+#endif // SHAREDCOMMANDQUEUE_HPP
@@ -18,7 +18,6 @@
 #ifndef TEXTURELOADOPTIMIZER_HPP
 #define TEXTURELOADOPTIMIZER_HPP
 
-#include "RIXDisplayListAssembler.hpp"
 #include "renderer/commands/RegularTriangleCmd.hpp"
 #include "renderer/commands/SetVertexCtxCmd.hpp"
 #include "renderer/commands/TextureStreamCmd.hpp"
@@ -27,37 +26,29 @@
 #include <array>
 #include <bitset>
 #include <stdint.h>
-#include <tcb/span.hpp>
+#include <type_traits>
 
 namespace rr::displaylist
 {
-// Optimization for texture loading: To avoid unecessary texture loads, track if a texture was used by a triangle.
-// If the texture wasn't used, then it replaces previous texture load with NOPs.
-template <std::size_t TMU_COUNT, typename TDisplayList>
+// Optimizer pass for texture loading: To avoid unecessary texture loads, track if a texture was used by a triangle.
+// If the texture wasn't used, then the previous texture load is eliminated.
+template <std::size_t TMU_COUNT>
 class TextureLoadOptimizer
 {
 public:
-    TextureLoadOptimizer(TDisplayList& displayList)
-        : m_displayList { displayList }
-    {
-        reset();
-    }
-
     void reset()
     {
         m_textureCommandFlag.reset();
     }
 
-    template <typename TCommand>
-    void optimize(const TCommand& cmd)
+    template <typename TCommand, typename TOptimizer>
+    bool filter(const typename TOptimizer::CommandInfo&, TOptimizer&)
     {
-        markTriangleCommand<TCommand>();
-        optimizeTextureLoad(cmd);
+        return true;
     }
 
-private:
-    template <typename TCommand>
-    void markTriangleCommand()
+    template <typename TCommand, typename TOptimizer>
+    void added(const typename TOptimizer::CommandInfo& cmd, TOptimizer& optimizer)
     {
         if constexpr (std::is_same<TCommand, TriangleStreamCmd>::value
             || std::is_same<TCommand, RegularTriangleCmd>::value
@@ -65,30 +56,24 @@ private:
         {
             m_textureCommandFlag.reset();
         }
-    }
-
-    template <typename TCommand>
-    void optimizeTextureLoad(const TCommand& cmd)
-    {
         if constexpr (std::is_same<TCommand, TextureStreamCmd>::value)
         {
-            const std::size_t tmu = cmd.getTmu();
+            const std::size_t tmu = TextureStreamCmd::getTmuByCommand(cmd.op);
             if (tmu >= m_textureCommandFlag.size())
             {
                 return;
             }
             if (m_textureCommandFlag[tmu])
             {
-                m_displayList.initArea(m_texPosInDisplayList[tmu], m_texSizeInDisplayList[tmu]);
+                optimizer.eliminate(m_texPosInDisplayList[tmu], m_texSizeInDisplayList[tmu]);
             }
             m_textureCommandFlag.set(tmu);
-            m_texPosInDisplayList[tmu] = m_displayList.getCurrentWritePos();
-            m_texSizeInDisplayList[tmu] = RIXDisplayListAssembler<TDisplayList>::template getCommandSize(cmd);
+            m_texPosInDisplayList[tmu] = cmd.pos;
+            m_texSizeInDisplayList[tmu] = cmd.size;
         }
     }
 
-    TDisplayList& m_displayList;
-
+private:
     std::bitset<TMU_COUNT> m_textureCommandFlag {};
     std::array<uint32_t, TMU_COUNT> m_texPosInDisplayList {};
     std::array<uint32_t, TMU_COUNT> m_texSizeInDisplayList {};
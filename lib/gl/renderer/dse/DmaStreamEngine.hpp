@@ -55,6 +55,11 @@ public:
         return m_busConnector.clearToSend();
     }
 
+    bool waitClearToSend(const std::chrono::milliseconds timeout) override
+    {
+        return m_busConnector.waitClearToSend(timeout);
+    }
+
     tcb::span<uint8_t> requestDisplayListBuffer(const uint8_t index) override
     {
         tcb::span<uint8_t> s = m_busConnector.requestBuffer(index);
@@ -0,0 +1,432 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _COMMAND_PROCESSOR_HPP_
+#define _COMMAND_PROCESSOR_HPP_
+
+#include "renderer/displaylist/DisplayList.hpp"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <tcb/span.hpp>
+
+#include "renderer/commands/FogLutStreamCmd.hpp"
+#include "renderer/commands/FramebufferCmd.hpp"
+#include "renderer/commands/NopCmd.hpp"
+#include "renderer/commands/PushVertexBatchCmd.hpp"
+#include "renderer/commands/PushVertexCmd.hpp"
+#include "renderer/commands/RegularTriangleCmd.hpp"
+#include "renderer/commands/SetVertexCtxCmd.hpp"
+#include "renderer/commands/TextureStreamCmd.hpp"
+#include "renderer/commands/TriangleStreamCmd.hpp"
+#include "renderer/commands/WriteRegisterCmd.hpp"
+
+#include "renderer/Rasterizer.hpp"
+#include "renderer/registers/BaseColorReg.hpp"
+
+#include "renderer/registers/FeatureEnableReg.hpp"
+#include "renderer/registers/ScissorEndReg.hpp"
+#include "renderer/registers/ScissorStartReg.hpp"
+
+#include <spdlog/spdlog.h>
+
+namespace rr
+{
+
+// Decodes the display list of the renderer, transforms and rasterizes the vertices and triangles, and writes
+// the display list for the hardware into an output. The output provides with getBack() the display list
+// assembler which receives the commands, and with flush() a way to get a new one when it is full.
+template <typename TOutput>
+class CommandProcessor
+{
+public:
+    CommandProcessor(TOutput& output)
+        : m_output { output }
+    {
+    }
+
+    // Continues with the state of another processor. Used to process a part of a display list
+    // which starts at a vertex context, in parallel to other parts.
+    template <typename TOtherOutput>
+    void setState(const CommandProcessor<TOtherOutput>& other)
+    {
+        m_rasterizer = other.getRasterizer();
+        m_vertexCtx = other.getVertexCtx();
+        resetVertexTransform();
+    }
+
+    Rasterizer& getRasterizer() { return m_rasterizer; }
+    const Rasterizer& getRasterizer() const { return m_rasterizer; }
+    const vertextransforming::VertexTransformingData& getVertexCtx() const { return m_vertexCtx; }
+
+    // Processes all commands of src
+    void processAll(displaylist::DisplayList& src)
+    {
+        while (!src.atEnd())
+        {
+            if (!decodeAndCopyCommand(src))
+            {
+                m_output.flush();
+            }
+        }
+    }
+
+    // Applies the state changes of the next command of src without creating any output
+    void applyState(displaylist::DisplayList& src)
+    {
+        const uint32_t op = *(src.lookAhead<uint32_t>());
+        if (SetVertexCtxCmd::isThis(op))
+        {
+            setVertexCtx(src);
+            return;
+        }
+        if (WriteRegisterCmd<BaseColorReg>::isThis(op))
+        {
+            updateRasterizer(src);
+        }
+        skipCommand(src);
+    }
+
+    // Copies a command which does not require a transformation or rasterization into the output.
+    // Returns false when the output is full.
+    bool copyCommand(displaylist::DisplayList& src)
+    {
+        const uint32_t op = *(src.lookAhead<uint32_t>());
+        if (TriangleStreamCmd::isThis(op))
+        {
+            return copyCmd<TriangleStreamCmd>(src);
+        }
+        else if (WriteRegisterCmd<BaseColorReg>::isThis(op))
+        {
+            return copyCmd<WriteRegisterCmd<BaseColorReg>>(src);
+        }
+        else if (NopCmd::isThis(op))
+        {
+            return copyCmd<NopCmd>(src);
+        }
+        else if (TextureStreamCmd::isThis(op))
+        {
+            return copyCmd<TextureStreamCmd>(src);
+        }
+        else if (FramebufferCmd::isThis(op))
+        {
+            return copyCmd<FramebufferCmd>(src);
+        }
+        else if (FogLutStreamCmd::isThis(op))
+        {
+            return copyCmd<FogLutStreamCmd>(src);
+        }
+        SPDLOG_CRITICAL("Unknown command (0x{:X})found. This might cause the renderer to crash ...", op);
+        skipCommand(src);
+        return true;
+    }
+
+    // Skips the next command of src
+    static void skipCommand(displaylist::DisplayList& src)
+    {
+        const uint32_t op = *(src.lookAhead<uint32_t>());
+        if (RegularTriangleCmd::isThis(op))
+        {
+            skipCmd<RegularTriangleCmd>(src);
+        }
+        else if (TriangleStreamCmd::isThis(op))
+        {
+            skipCmd<TriangleStreamCmd>(src);
+        }
+        else if (SetVertexCtxCmd::isThis(op))
+        {
+            skipCmd<SetVertexCtxCmd>(src);
+        }
+        else if (PushVertexCmd::isThis(op))
+        {
+            skipCmd<PushVertexCmd>(src);
+        }
+        else if (PushVertexBatchCmd::isThis(op))
+        {
+            skipCmd<PushVertexBatchCmd>(src);
+        }
+        else if (WriteRegisterCmd<BaseColorReg>::isThis(op))
+        {
+            skipCmd<WriteRegisterCmd<BaseColorReg>>(src);
+        }
+        else if (TextureStreamCmd::isThis(op))
+        {
+            skipCmd<TextureStreamCmd>(src);
+        }
+        else if (FramebufferCmd::isThis(op))
+        {
+            skipCmd<FramebufferCmd>(src);
+        }
+        else if (FogLutStreamCmd::isThis(op))
+        {
+            skipCmd<FogLutStreamCmd>(src);
+        }
+        else
+        {
+            skipCmd<NopCmd>(src);
+        }
+    }
+
+private:
+    // This describes the free capacity in the display list for the triangles.
+    // When the triangle is transformed and clipped, around 9 new triangles can
+    // be generated. This variable keeps a minimum of 10 (to be safe) triangle
+    // commands in the display list free for the worst case.
+    static constexpr std::size_t TRIANGLE_RESERVE_CAPACITY { 10 };
+
+    template <typename TCmd>
+    bool copyCmd(displaylist::DisplayList& src)
+    {
+        return m_output.getBack().template copyCommand<TCmd>(src);
+    }
+
+    template <typename TCmd>
+    static void skipCmd(displaylist::DisplayList& src)
+    {
+        const typename TCmd::CommandType op = *(src.getNext<typename TCmd::CommandType>());
+        src.getNextArray<typename TCmd::PayloadType::value_type>(TCmd::getNumberOfElementsInPayloadByCommand(op));
+    }
+
+    void resetVertexTransform()
+    {
+        new (&m_vertexTransform) vertextransforming::VertexTransformingCalc<decltype(drawTriangleLambda), decltype(setStencilBufferConfigLambda)> {
+            m_vertexCtx,
+            drawTriangleLambda,
+            setStencilBufferConfigLambda,
+        };
+    }
+
+    bool setVertexCtx(displaylist::DisplayList& src)
+    {
+        const uint32_t op = *(src.getNext<typename SetVertexCtxCmd::CommandType>());
+        const std::size_t payloadSize = SetVertexCtxCmd::getNumberOfElementsInPayloadByCommand(op);
+        const uint32_t* payload = src.getNextArray<uint32_t>(payloadSize);
+
+        // The command only contains the changed blocks. Patch them into the resident copy.
+        SetVertexCtxCmd::apply(op, { payload, payloadSize }, m_vertexCtx);
+
+        resetVertexTransform();
+
+        return true;
+    }
+
+    // Checks if the output has enough space for the triangles which can be generated by vertexCount vertices
+    bool hasTriangleCapacity(const std::size_t vertexCount)
+    {
+        return m_output.getBack().getFreeSpace() >= (m_output.getBack().template getCommandSize<TriangleStreamCmd>(1) * TRIANGLE_RESERVE_CAPACITY * vertexCount);
+    }
+
+    void reserveTriangleCapacity()
+    {
+        if (!hasTriangleCapacity(1))
+        {
+            m_output.flush();
+        }
+    }
+
+    bool pushVertex(displaylist::DisplayList& src)
+    {
+        reserveTriangleCapacity();
+        using PayloadType = typename std::remove_const<typename std::remove_reference<decltype(PushVertexCmd {}.payload()[0])>::type>::type;
+        src.getNext<typename PushVertexCmd::CommandType>();
+        return m_vertexTransform.pushVertex(src.getNext<PayloadType>()->vertex);
+    }
+
+    bool pushVertexBatch(displaylist::DisplayList& src)
+    {
+        const uint32_t op = *(src.getNext<typename PushVertexBatchCmd::CommandType>());
+        const std::size_t payloadSize = PushVertexBatchCmd::getNumberOfElementsInPayloadByCommand(op);
+        const uint32_t* payload = src.getNextArray<uint32_t>(payloadSize);
+
+        // Check the free space only once for the whole batch. Only when the space is running out,
+        // the space is checked for every vertex and the output is flushed when required.
+        const bool reserved = hasTriangleCapacity(PushVertexBatchCmd::getVertexCount(op, { payload, payloadSize }));
+        if (reserved)
+        {
+            // Decode the whole batch to transform the positions in one go
+            std::size_t count = 0;
+            std::size_t vertexCount = 0;
+            PushVertexBatchCmd::decode(op, { payload, payloadSize }, [this, &count, &vertexCount](const VertexParameter& vertex, const VertexCacheTag tag)
+                {
+                    if (tag.op != VertexCacheTag::Op::REUSE)
+                    {
+                        m_batchVertices[vertexCount++] = vertex;
+                    }
+                    m_batchTags[count++] = tag;
+                    return true;
+                });
+            return m_vertexTransform.pushVertices({ m_batchVertices.data(), vertexCount }, { m_batchTags.data(), count });
+        }
+        return PushVertexBatchCmd::decode(op, { payload, payloadSize }, [this](const VertexParameter& vertex, const VertexCacheTag tag)
+            {
+                reserveTriangleCapacity();
+                return m_vertexTransform.pushVertex(vertex, tag);
+            });
+    }
+
+    bool addTriangleCmd(displaylist::DisplayList& src)
+    {
+        using PayloadType = typename std::remove_const<typename std::remove_reference<decltype(RegularTriangleCmd {}.payload()[0])>::type>::type;
+        if (m_output.getBack().getFreeSpace()
+            < m_output.getBack().template getCommandSize<TriangleStreamCmd>(1))
+        {
+            return false;
+        }
+        src.getNext<typename RegularTriangleCmd::CommandType>();
+        const PayloadType* t = src.getNext<PayloadType>();
+
+        return addTriangleCmd({
+                                  t->vertex0,
+                                  t->vertex1,
+                                  t->vertex2,
+                                  t->texture0,
+                                  t->texture1,
+                                  t->texture2,
+                                  t->color0,
+                                  t->color1,
+                                  t->color2,
+                              },
+            t->lineStart, t->lineEnd);
+    }
+
+    bool addTriangleCmd(const TransformedTriangle& triangle, const std::size_t lineStart, const std::size_t lineEnd)
+    {
+        TriangleStreamCmd tsc { m_rasterizer, triangle };
+
+        if (tsc.isVisible())
+        {
+            return m_output.getBack().addCommand(tsc.getIncremented(lineStart, lineEnd));
+        }
+        return true;
+    }
+
+    bool addTriangleCmd(const TransformedTriangle& triangle)
+    {
+        TriangleStreamCmd tsc { m_rasterizer, triangle };
+
+        if (tsc.isVisible())
+        {
+            return addVertexOutput(tsc);
+        }
+        return true;
+    }
+
+    // Adds a command which is generated by the vertex transformation. The vertex command is already consumed
+    // from the source display list and can not be processed again. Therefore a full output is flushed and the
+    // command is added to the new display list instead of reporting the failure to the caller.
+    template <typename TCmd>
+    bool addVertexOutput(const TCmd& cmd)
+    {
+        if (m_output.getBack().addCommand(cmd))
+        {
+            return true;
+        }
+        m_output.flush();
+        return m_output.getBack().addCommand(cmd);
+    }
+
+    void updateRasterizer(const displaylist::DisplayList& src)
+    {
+        const uint32_t op = *(src.lookAhead<uint32_t>(1));
+        const uint32_t regData = *(src.lookAhead<uint32_t>(2));
+        switch (WriteRegisterCmd<BaseColorReg>::getRegAddr(op))
+        {
+        case FeatureEnableReg::getAddr():
+        {
+            FeatureEnableReg reg {};
+            reg.deserialize(regData);
+            m_rasterizer.enableScissor(reg.getEnableScissor());
+            m_rasterizer.enableTmu(0, reg.getEnableTmu(0));
+            m_rasterizer.enableTmu(1, reg.getEnableTmu(1));
+        }
+        break;
+        case ScissorStartReg::getAddr():
+        {
+            ScissorStartReg reg {};
+            reg.deserialize(regData);
+            m_rasterizer.setScissorStart(reg.getX(), reg.getY());
+        }
+        break;
+        case ScissorEndReg::getAddr():
+        {
+            ScissorEndReg reg {};
+            reg.deserialize(regData);
+            m_rasterizer.setScissorEnd(reg.getX(), reg.getY());
+        }
+        break;
+
+        default:
+            break;
+        }
+    }
+
+    bool decodeAndCopyCommand(displaylist::DisplayList& srcList)
+    {
+        const uint32_t op = *(srcList.lookAhead<uint32_t>());
+        if (RegularTriangleCmd::isThis(op))
+        {
+            return addTriangleCmd(srcList);
+        }
+        else if (SetVertexCtxCmd::isThis(op))
+        {
+            return setVertexCtx(srcList);
+        }
+        else if (PushVertexCmd::isThis(op))
+        {
+            return pushVertex(srcList);
+        }
+        else if (PushVertexBatchCmd::isThis(op))
+        {
+            return pushVertexBatch(srcList);
+        }
+        else if (WriteRegisterCmd<BaseColorReg>::isThis(op))
+        {
+            updateRasterizer(srcList);
+        }
+        return copyCommand(srcList);
+    }
+
+    bool setStencilBufferConfig(const StencilReg& stencilConf)
+    {
+        return addVertexOutput(WriteRegisterCmd<StencilReg> { stencilConf });
+    }
+
+    TOutput& m_output;
+    Rasterizer m_rasterizer { !RenderConfig::USE_FLOAT_INTERPOLATION };
+
+    const std::function<bool(const TransformedTriangle&)> drawTriangleLambda = [this](const TransformedTriangle& triangle)
+    {
+        return addTriangleCmd(triangle);
+    };
+    const std::function<bool(const StencilReg&)> setStencilBufferConfigLambda = [this](const StencilReg& stencilConf)
+    { return setStencilBufferConfig(stencilConf); };
+
+    vertextransforming::VertexTransformingData m_vertexCtx {};
+    vertextransforming::VertexTransformingCalc<decltype(drawTriangleLambda), decltype(setStencilBufferConfigLambda)> m_vertexTransform {
+        m_vertexCtx,
+        drawTriangleLambda,
+        setStencilBufferConfigLambda,
+    };
+
+    // Decoded vertices of a PushVertexBatchCmd
+    std::array<VertexParameter, RenderConfig::THREADED_RASTERIZATION_VERTEX_BATCH_SIZE> m_batchVertices;
+    std::array<VertexCacheTag, RenderConfig::THREADED_RASTERIZATION_VERTEX_BATCH_SIZE> m_batchTags;
+};
+
+} // namespace rr
+
+#endif // _COMMAND_PROCESSOR_HPP_
@@ -0,0 +1,186 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _DISPLAY_LIST_QUEUE_HPP_
+#define _DISPLAY_LIST_QUEUE_HPP_
+
+#include "DisplayListQueueStatistics.hpp"
+#include "WaitCondition.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace rr
+{
+
+// Single producer, single consumer queue of display lists. The producer pushes the display lists, the consumer
+// pops them and releases them when it has processed them. The indices are atomics, therefore no lock is taken
+// as long as no side has to wait. When the queue is full, empty, or the producer waits till all display lists
+// are processed, the waiting side waits on the WaitCondition.
+template <std::size_t CAPACITY>
+class DisplayListQueue
+{
+    using Clock = std::chrono::steady_clock;
+
+public:
+    struct Entry
+    {
+        uint8_t index { 0 };
+        uint32_t size { 0 };
+    };
+
+    // Enables the queue. Must only be called when the queue is empty and no consumer is running.
+    void open()
+    {
+        m_closed.store(false);
+    }
+
+    // Disables the queue and wakes up the consumer. pop() returns false when the queue is closed and empty.
+    void close()
+    {
+        m_closed.store(true);
+        m_waitCondition.notify();
+    }
+
+    // Producer: Adds a display list. Waits while the queue is full.
+    void push(const Entry& entry)
+    {
+        const std::size_t pushed = m_pushed.load(std::memory_order_relaxed);
+        wait([&]()
+            { return (pushed - m_popped.load()) < CAPACITY; },
+            m_statistics.producerWaits, m_statistics.producerWaitTime);
+        m_slots[pushed % CAPACITY] = { entry, Clock::now() };
+        m_pushed.store(pushed + 1);
+        m_waitCondition.notify();
+    }
+
+    // Consumer: Takes the next display list. Waits while the queue is empty.
+    // Returns false if the queue is closed and empty.
+    bool pop(Entry& entry)
+    {
+        const std::size_t popped = m_popped.load(std::memory_order_relaxed);
+        wait([&]()
+            { return (m_pushed.load() != popped) || m_closed.load(); },
+            m_statistics.consumerWaits, m_statistics.consumerWaitTime);
+        if (m_pushed.load() == popped)
+        {
+            return false;
+        }
+        const Slot& slot = m_slots[popped % CAPACITY];
+        entry = slot.entry;
+        m_popTime = Clock::now();
+        const uint64_t latency = toNs(m_popTime - slot.pushTime);
+        m_statistics.totalLatency.fetch_add(latency, std::memory_order_relaxed);
+        if (latency > m_statistics.maxLatency.load(std::memory_order_relaxed))
+        {
+            m_statistics.maxLatency.store(latency, std::memory_order_relaxed);
+        }
+        m_popped.store(popped + 1);
+        m_waitCondition.notify();
+        return true;
+    }
+
+    // Consumer: Signals that the last popped display list is processed and its buffer can be reused
+    void release()
+    {
+        m_statistics.consumerBusyTime.fetch_add(toNs(Clock::now() - m_popTime), std::memory_order_relaxed);
+        m_statistics.displayLists.fetch_add(1, std::memory_order_relaxed);
+        m_released.fetch_add(1);
+        m_waitCondition.notify();
+    }
+
+    // Producer: Waits till all pushed display lists are released
+    void waitTillIdle()
+    {
+        const std::size_t pushed = m_pushed.load();
+        wait([&]()
+            { return m_released.load() == pushed; },
+            m_statistics.idleWaits, m_statistics.idleWaitTime);
+    }
+
+    DisplayListQueueStatistics getStatistics() const
+    {
+        DisplayListQueueStatistics statistics {};
+        statistics.displayLists = m_statistics.displayLists.load(std::memory_order_relaxed);
+        statistics.producerWaits = m_statistics.producerWaits.load(std::memory_order_relaxed);
+        statistics.producerWaitTime = m_statistics.producerWaitTime.load(std::memory_order_relaxed);
+        statistics.consumerWaits = m_statistics.consumerWaits.load(std::memory_order_relaxed);
+        statistics.consumerWaitTime = m_statistics.consumerWaitTime.load(std::memory_order_relaxed);
+        statistics.idleWaits = m_statistics.idleWaits.load(std::memory_order_relaxed);
+        statistics.idleWaitTime = m_statistics.idleWaitTime.load(std::memory_order_relaxed);
+        statistics.consumerBusyTime = m_statistics.consumerBusyTime.load(std::memory_order_relaxed);
+        statistics.totalLatency = m_statistics.totalLatency.load(std::memory_order_relaxed);
+        statistics.maxLatency = m_statistics.maxLatency.load(std::memory_order_relaxed);
+        return statistics;
+    }
+
+private:
+    struct Slot
+    {
+        Entry entry {};
+        Clock::time_point pushTime {};
+    };
+
+    struct Statistics
+    {
+        std::atomic<std::size_t> displayLists { 0 };
+        std::atomic<std::size_t> producerWaits { 0 };
+        std::atomic<uint64_t> producerWaitTime { 0 };
+        std::atomic<std::size_t> consumerWaits { 0 };
+        std::atomic<uint64_t> consumerWaitTime { 0 };
+        std::atomic<std::size_t> idleWaits { 0 };
+        std::atomic<uint64_t> idleWaitTime { 0 };
+        std::atomic<uint64_t> consumerBusyTime { 0 };
+        std::atomic<uint64_t> totalLatency { 0 };
+        std::atomic<uint64_t> maxLatency { 0 };
+    };
+
+    static uint64_t toNs(const Clock::duration duration)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    }
+
+    template <typename Pred>
+    void wait(const Pred& pred, std::atomic<std::size_t>& waits, std::atomic<uint64_t>& waitTime)
+    {
+        if (pred())
+        {
+            return;
+        }
+        const Clock::time_point start = Clock::now();
+        m_waitCondition.wait(pred);
+        waits.fetch_add(1, std::memory_order_relaxed);
+        waitTime.fetch_add(toNs(Clock::now() - start), std::memory_order_relaxed);
+    }
+
+    std::array<Slot, CAPACITY> m_slots {};
+
+    // Monotonic counters. The slot of an entry is the counter modulo the capacity.
+    std::atomic<std::size_t> m_pushed { 0 };
+    std::atomic<std::size_t> m_popped { 0 };
+    std::atomic<std::size_t> m_released { 0 };
+    std::atomic<bool> m_closed { true };
+    Clock::time_point m_popTime {};
+
+    WaitCondition m_waitCondition {};
+    Statistics m_statistics {};
+};
+
+} // namespace rr
+
+#endif // _DISPLAY_LIST_QUEUE_HPP_
@@ -0,0 +1,45 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _DISPLAY_LIST_QUEUE_STATISTICS_HPP_
+#define _DISPLAY_LIST_QUEUE_STATISTICS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rr
+{
+
+// Counters of the queue which hands the display lists over to the rasterizer thread.
+// All times are in nanoseconds.
+struct DisplayListQueueStatistics
+{
+    std::size_t displayLists { 0 }; // Display lists handed over to the rasterizer thread
+    std::size_t producerWaits { 0 }; // How often the producer waited because the queue was full
+    uint64_t producerWaitTime { 0 };
+    std::size_t consumerWaits { 0 }; // How often the rasterizer thread waited because the queue was empty
+    uint64_t consumerWaitTime { 0 };
+    std::size_t idleWaits { 0 }; // How often the producer waited till all display lists were processed
+    uint64_t idleWaitTime { 0 };
+    uint64_t consumerBusyTime { 0 }; // Time the rasterizer thread spent processing display lists
+    uint64_t totalLatency { 0 }; // Sum of the times the display lists waited in the queue
+    uint64_t maxLatency { 0 };
+};
+
+} // namespace rr
+
+#endif // _DISPLAY_LIST_QUEUE_STATISTICS_HPP_
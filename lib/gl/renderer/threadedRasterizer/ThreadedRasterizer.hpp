@@ -18,30 +18,18 @@
 #ifndef _THREADED_RASTERIZER_HPP_
 #define _THREADED_RASTERIZER_HPP_
 
+#include "CommandProcessor.hpp"
+#include "DisplayListQueue.hpp"
+#include "IThreadRunner.hpp"
 #include "renderer/IDevice.hpp"
 #include "renderer/displaylist/DisplayList.hpp"
 #include "renderer/displaylist/DisplayListAssembler.hpp"
 #include "renderer/displaylist/DisplayListDoubleBuffer.hpp"
 #include "renderer/displaylist/RIXDisplayListAssembler.hpp"
+#include <algorithm>
 #include <cstdint>
 #include <tcb/span.hpp>
-
-#include "renderer/commands/FogLutStreamCmd.hpp"
-#include "renderer/commands/FramebufferCmd.hpp"
-#include "renderer/commands/NopCmd.hpp"
-#include "renderer/commands/PushVertexCmd.hpp"
-#include "renderer/commands/RegularTriangleCmd.hpp"
-#include "renderer/commands/SetVertexCtxCmd.hpp"
-#include "renderer/commands/TextureStreamCmd.hpp"
-#include "renderer/commands/TriangleStreamCmd.hpp"
-#include "renderer/commands/WriteRegisterCmd.hpp"
-
-#include "renderer/Rasterizer.hpp"
-#include "renderer/registers/BaseColorReg.hpp"
-
-#include "renderer/registers/FeatureEnableReg.hpp"
-#include "renderer/registers/ScissorEndReg.hpp"
-#include "renderer/registers/ScissorStartReg.hpp"
+#include <vector>
 
 #include <spdlog/spdlog.h>
 
@@ -57,32 +45,98 @@ public:
     {
         m_displayListAssembler[0].setBuffer(m_device.requestDisplayListBuffer(0), 0);
         m_displayListAssembler[1].setBuffer(m_device.requestDisplayListBuffer(1), 1);
-        m_rasterizer.enableTmu(0, true);
+        m_processor.getRasterizer().enableTmu(0, true);
         SPDLOG_INFO("Treaded rasterization enabled");
     }
 
-    void streamDisplayList(const uint8_t index, const uint32_t size) override
+    ~ThreadedRasterizer()
     {
-        displaylist::DisplayList srcList {};
-        srcList.setBuffer(requestDisplayListBuffer(index));
-        srcList.resetGet();
-        srcList.setCurrentSize(size);
+        setThread(nullptr);
+    }
 
-        while (!srcList.atEnd())
+    // Sets the runner of the rasterizer thread. The display lists are then handed over through a queue and
+    // processed in this thread, otherwise they are processed directly in streamDisplayList(). The runner
+    // must execute the operation concurrently to the calling thread and is occupied till the thread is
+    // disabled with a nullptr. Must not be called while a display list is streamed.
+    void setThread(IThreadRunner* runner)
+    {
+        if (m_thread)
+        {
+            m_queue.close();
+            m_thread->wait();
+        }
+        m_thread = runner;
+        if (m_thread)
+        {
+            m_queue.open();
+            m_thread->run([this]()
+                { return runThread(); });
+        }
+    }
+
+    DisplayListQueueStatistics getQueueStatistics() const
+    {
+        return m_queue.getStatistics();
+    }
+
+    // Sets the workers which transform and rasterize the vertices in parallel. A display list is split at the
+    // vertex contexts into chunks, one per worker. Every worker writes into a private display list. They are
+    // merged in the order of the source display list, therefore the result is the same as without workers.
+    // The runners must execute the operation concurrently to the calling thread. An empty span disables the
+    // workers. Must not be called while a display list is streamed.
+    bool setWorkers(tcb::span<IThreadRunner* const> workers)
+    {
+        if (workers.size() > m_workers.size())
         {
-            if (!decodeAndCopyCommand(srcList))
+            SPDLOG_ERROR("setWorkers(): Too many workers ({})", workers.size());
+            return false;
+        }
+        for (std::size_t i = 0; i < m_workers.size(); i++)
+        {
+            Worker& worker = m_workers[i];
+            worker.runner = (i < workers.size()) ? workers[i] : nullptr;
+            worker.buffers.clear();
+            worker.buffers.shrink_to_fit();
+            worker.sizes.clear();
+            if (worker.runner)
+            {
+                worker.buffers.emplace_back(BUFFER_SIZE);
+                worker.sizes.emplace_back(0);
+                worker.reset();
+            }
+            else
             {
-                swapAndPrepareDisplayList();
+                worker.assembler.setBuffer({}, 0);
             }
         }
-        if (m_displayLists.getBack().getDisplayListSize() > 0)
+        m_workerCount = workers.size();
+        return true;
+    }
+
+    void streamDisplayList(const uint8_t index, const uint32_t size) override
+    {
+        if (m_thread)
         {
-            swapAndPrepareDisplayList();
+            m_queue.push({ index, size });
+        }
+        else
+        {
+            processDisplayList(index, size);
+        }
+    }
+
+    void waitTillIdle() override
+    {
+        if (m_thread)
+        {
+            m_queue.waitTillIdle();
         }
     }
 
     void writeToDeviceMemory(tcb::span<const uint8_t> data, const uint32_t addr) override
     {
+        // The memory must be written in order with the display lists
+        waitTillIdle();
         waitTillBusIsFree();
         m_device.writeToDeviceMemory(data, addr);
     }
@@ -92,6 +146,11 @@ public:
         return true;
     }
 
+    bool waitClearToSend(const std::chrono::milliseconds) override
+    {
+        return true;
+    }
+
     tcb::span<uint8_t> requestDisplayListBuffer(const uint8_t index) override
     {
         return { m_buffer[index] };
@@ -103,178 +162,207 @@ public:
     }
 
 private:
-    // This describes the free capacity in the display list for the triangles.
-    // When the triangle is transformed and clipped, around 9 new triangles can
-    // be generated. This variable keeps a minimum of 10 (to be safe) triangle
-    // commands in the display list free for the worst case.
-    static constexpr std::size_t TRIANGLE_RESERVE_CAPACITY { 10 };
-
-    template <typename TCmd>
-    bool copyCmd(displaylist::DisplayList& src)
-    {
-        return m_displayLists.getBack().copyCommand<TCmd>(src);
-    }
-
-    bool setVertexCtx(displaylist::DisplayList& src)
+    void processDisplayList(const uint8_t index, const uint32_t size)
     {
-        using PayloadType = typename std::remove_const<typename std::remove_reference<decltype(SetVertexCtxCmd {}.payload()[0])>::type>::type;
-        src.getNext<typename SetVertexCtxCmd::CommandType>();
-        const PayloadType* t = src.getNext<PayloadType>();
-
-        new (&m_vertexTransform) vertextransforming::VertexTransformingCalc<decltype(drawTriangleLambda), decltype(setStencilBufferConfigLambda)> {
-            t->ctx,
-            drawTriangleLambda,
-            setStencilBufferConfigLambda,
-        };
-
-        return true;
-    }
+        displaylist::DisplayList srcList {};
+        srcList.setBuffer(requestDisplayListBuffer(index));
+        srcList.resetGet();
+        srcList.setCurrentSize(size);
 
-    bool pushVertex(displaylist::DisplayList& src)
-    {
-        if (m_displayLists.getBack().getFreeSpace() < (m_displayLists.getBack().getCommandSize<TriangleStreamCmd>(1) * TRIANGLE_RESERVE_CAPACITY))
+        if (m_workerCount > 0)
         {
-            swapAndPrepareDisplayList();
+            processParallel(srcList);
         }
-        using PayloadType = typename std::remove_const<typename std::remove_reference<decltype(PushVertexCmd {}.payload()[0])>::type>::type;
-        src.getNext<typename PushVertexCmd::CommandType>();
-        return m_vertexTransform.pushVertex(src.getNext<PayloadType>()->vertex);
-    }
-
-    bool addTriangleCmd(displaylist::DisplayList& src)
-    {
-        using PayloadType = typename std::remove_const<typename std::remove_reference<decltype(RegularTriangleCmd {}.payload()[0])>::type>::type;
-        if (m_displayLists.getBack().getFreeSpace()
-            < m_displayLists.getBack().getCommandSize<TriangleStreamCmd>(1))
+        else
         {
-            return false;
+            m_processor.processAll(srcList);
         }
-        src.getNext<typename RegularTriangleCmd::CommandType>();
-        const PayloadType* t = src.getNext<PayloadType>();
-
-        return addTriangleCmd({
-                                  t->vertex0,
-                                  t->vertex1,
-                                  t->vertex2,
-                                  t->texture0,
-                                  t->texture1,
-                                  t->texture2,
-                                  t->color0,
-                                  t->color1,
-                                  t->color2,
-                              },
-            t->lineStart, t->lineEnd);
-    }
-
-    bool addTriangleCmd(const TransformedTriangle& triangle, const std::size_t lineStart, const std::size_t lineEnd)
-    {
-        TriangleStreamCmd tsc { m_rasterizer, triangle };
-
-        if (tsc.isVisible())
+        if (m_displayLists.getBack().getDisplayListSize() > 0)
         {
-            return m_displayLists.getBack().addCommand(tsc.getIncremented(lineStart, lineEnd));
+            swapAndPrepareDisplayList();
         }
-        return true;
     }
 
-    bool addTriangleCmd(const TransformedTriangle& triangle)
+    bool runThread()
     {
-        TriangleStreamCmd tsc { m_rasterizer, triangle };
-
-        if (tsc.isVisible())
+        typename QueueType::Entry entry {};
+        while (m_queue.pop(entry))
         {
-            return m_displayLists.getBack().addCommand(tsc);
+            processDisplayList(entry.index, entry.size);
+            m_queue.release();
         }
         return true;
     }
 
-    void updateRasterizer(const displaylist::DisplayList& src)
+    using ConcreteDisplayListAssembler = displaylist::DisplayListAssembler<RenderConfig::TMU_COUNT, displaylist::DisplayList, false>;
+
+    // Output of this thread, which streams the display lists to the device
+    class DeviceOutput
     {
-        const uint32_t op = *(src.lookAhead<uint32_t>(1));
-        const uint32_t regData = *(src.lookAhead<uint32_t>(2));
-        switch (WriteRegisterCmd<BaseColorReg>::getRegAddr(op))
-        {
-        case FeatureEnableReg::getAddr():
-        {
-            FeatureEnableReg reg {};
-            reg.deserialize(regData);
-            m_rasterizer.enableScissor(reg.getEnableScissor());
-            m_rasterizer.enableTmu(0, reg.getEnableTmu(0));
-            m_rasterizer.enableTmu(1, reg.getEnableTmu(1));
-        }
-        break;
-        case ScissorStartReg::getAddr():
+    public:
+        DeviceOutput(ThreadedRasterizer& rasterizer)
+            : m_rasterizer { rasterizer }
         {
-            ScissorStartReg reg {};
-            reg.deserialize(regData);
-            m_rasterizer.setScissorStart(reg.getX(), reg.getY());
         }
-        break;
-        case ScissorEndReg::getAddr():
-        {
-            ScissorEndReg reg {};
-            reg.deserialize(regData);
-            m_rasterizer.setScissorEnd(reg.getX(), reg.getY());
-        }
-        break;
 
-        default:
-            break;
-        }
-    }
+        ConcreteDisplayListAssembler& getBack() { return m_rasterizer.m_displayLists.getBack(); }
+        void flush() { m_rasterizer.swapAndPrepareDisplayList(); }
 
-    bool decodeAndCopyCommand(displaylist::DisplayList& srcList)
+    private:
+        ThreadedRasterizer& m_rasterizer;
+    };
+
+    // A worker processes a chunk of the source display list into its private display lists. When one is full,
+    // the worker continues in the next one, therefore it never waits for the merge. The merge waits with the
+    // runner till the chunk is processed and copies the display lists in order. A display list is only full after
+    // several thousand triangles, therefore a worker rarely needs more than one. They are kept for the next chunks.
+    class Worker
     {
-        const uint32_t op = *(srcList.lookAhead<uint32_t>());
-        bool ret = true;
-        if (RegularTriangleCmd::isThis(op))
-        {
-            ret = addTriangleCmd(srcList);
-        }
-        else if (TriangleStreamCmd::isThis(op))
-        {
-            ret = copyCmd<TriangleStreamCmd>(srcList);
-        }
-        else if (SetVertexCtxCmd::isThis(op))
-        {
-            ret = setVertexCtx(srcList);
-        }
-        else if (PushVertexCmd::isThis(op))
+    public:
+        ConcreteDisplayListAssembler& getBack() { return assembler; }
+
+        // Worker: Continues in the next display list
+        void flush()
         {
-            ret = pushVertex(srcList);
+            sizes[used] = assembler.getDisplayListSize();
+            used++;
+            if (used == buffers.size())
+            {
+                buffers.emplace_back(BUFFER_SIZE);
+                sizes.emplace_back(0);
+            }
+            setBuffer(used);
         }
-        else if (WriteRegisterCmd<BaseColorReg>::isThis(op))
+
+        // Starts the output in the first display list
+        void reset()
         {
-            updateRasterizer(srcList);
-            ret = copyCmd<WriteRegisterCmd<BaseColorReg>>(srcList);
+            used = 0;
+            setBuffer(0);
         }
-        else if (NopCmd::isThis(op))
+
+        // Merge: Size of the display list with the index. The last used display list is still in the assembler.
+        std::size_t getSize(const std::size_t index) const
         {
-            ret = copyCmd<NopCmd>(srcList);
+            return (index < used) ? sizes[index] : assembler.getDisplayListSize();
         }
-        else if (TextureStreamCmd::isThis(op))
+
+        IThreadRunner* runner { nullptr };
+        std::vector<std::vector<uint8_t>> buffers {};
+        std::vector<std::size_t> sizes {};
+        std::size_t used { 0 };
+        ConcreteDisplayListAssembler assembler {};
+        CommandProcessor<Worker> processor { *this };
+        displaylist::DisplayList chunk {};
+
+    private:
+        void setBuffer(const std::size_t index)
         {
-            ret = copyCmd<TextureStreamCmd>(srcList);
+            assembler.setBuffer(buffers[index], 0);
+            assembler.clearAssembler();
         }
-        else if (FramebufferCmd::isThis(op))
+    };
+
+    // Only the vertices between two vertex contexts are independent from the rest of the display list.
+    // The vertices before the first context continue the primitives of the previous display list and the
+    // vertices after the last context might be continued by the next display list. Both are processed by
+    // this thread, everything in between is split into chunks for the workers.
+    void processParallel(displaylist::DisplayList& srcList)
+    {
+        std::size_t firstCtx = srcList.getSize();
+        std::size_t lastCtx = srcList.getSize();
+        while (!srcList.atEnd())
         {
-            ret = copyCmd<FramebufferCmd>(srcList);
+            if (SetVertexCtxCmd::isThis(*(srcList.lookAhead<uint32_t>())))
+            {
+                firstCtx = (std::min)(firstCtx, srcList.getCurrentReadPos());
+                lastCtx = srcList.getCurrentReadPos();
+            }
+            ProcessorType::skipCommand(srcList);
         }
-        else if (FogLutStreamCmd::isThis(op))
+
+        displaylist::DisplayList head = getSection(srcList, 0, firstCtx);
+        m_processor.processAll(head);
+
+        if (lastCtx > firstCtx)
         {
-            ret = copyCmd<FogLutStreamCmd>(srcList);
+            const std::size_t chunkSize = (std::max)((lastCtx - firstCtx) / m_workerCount, RenderConfig::THREADED_RASTERIZATION_MIN_CHUNK_SIZE);
+            displaylist::DisplayList body = getSection(srcList, firstCtx, lastCtx);
+            std::size_t workers = 0;
+            while (!body.atEnd())
+            {
+                Worker& worker = m_workers[workers];
+                worker.processor.setState(m_processor);
+                const std::size_t start = body.getCurrentReadPos();
+                // The last worker takes the rest of the display list
+                const bool last = (workers + 1) == m_workerCount;
+                do
+                {
+                    m_processor.applyState(body);
+                } while (!body.atEnd()
+                    && (last || ((body.getCurrentReadPos() - start) < chunkSize) || !SetVertexCtxCmd::isThis(*(body.lookAhead<uint32_t>()))));
+                startWorker(worker, getSection(srcList, firstCtx + start, firstCtx + body.getCurrentReadPos()));
+                workers++;
+            }
+            for (std::size_t i = 0; i < workers; i++)
+            {
+                mergeWorker(m_workers[i]);
+            }
         }
-        else
+
+        displaylist::DisplayList tail = getSection(srcList, lastCtx, srcList.getSize());
+        m_processor.processAll(tail);
+    }
+
+    static displaylist::DisplayList getSection(displaylist::DisplayList& src, const std::size_t start, const std::size_t end)
+    {
+        displaylist::DisplayList section {};
+        section.setBuffer({ src.getAt<uint8_t>(start), end - start });
+        section.resetGet();
+        section.setCurrentSize(end - start);
+        return section;
+    }
+
+    void startWorker(Worker& worker, const displaylist::DisplayList& chunk)
+    {
+        worker.chunk = chunk;
+        worker.reset();
+        worker.runner->run([&worker]()
+            { return runWorker(worker); });
+    }
+
+    static bool runWorker(Worker& worker)
+    {
+        worker.processor.processAll(worker.chunk);
+        return true;
+    }
+
+    // Copies the display lists of the worker into the output when the worker has finished its chunk
+    void mergeWorker(Worker& worker)
+    {
+        worker.runner->wait();
+        for (std::size_t i = 0; i <= worker.used; i++)
         {
-            SPDLOG_CRITICAL("Unknown command (0x{:X})found. This might cause the renderer to crash ...", op);
+            displaylist::DisplayList src {};
+            src.setBuffer(worker.buffers[i]);
+            src.resetGet();
+            src.setCurrentSize(worker.getSize(i));
+            while (!src.atEnd())
+            {
+                if (!m_processor.copyCommand(src))
+                {
+                    swapAndPrepareDisplayList();
+                }
+            }
         }
-        return ret;
     }
 
     void waitTillBusIsFree()
     {
-        while (!m_device.clearToSend())
-            ;
+        while (!m_device.waitClearToSend(std::chrono::milliseconds { RenderConfig::DEVICE_CLEAR_TO_SEND_TIMEOUT_MS }))
+        {
+            SPDLOG_WARN("Device is not clear to send after {} ms", RenderConfig::DEVICE_CLEAR_TO_SEND_TIMEOUT_MS);
+        }
     }
 
     void swapAndPrepareDisplayList()
@@ -285,12 +373,8 @@ private:
         m_displayLists.getBack().clearAssembler();
     }
 
-    bool setStencilBufferConfig(const StencilReg& stencilConf)
-    {
-        return m_displayLists.getBack().addCommand(WriteRegisterCmd<StencilReg> { stencilConf });
-    }
-
-    using ConcreteDisplayListAssembler = displaylist::DisplayListAssembler<RenderConfig::TMU_COUNT, displaylist::DisplayList, false>;
+    using ProcessorType = CommandProcessor<DeviceOutput>;
+    using QueueType = DisplayListQueue<BUFFER_COUNT>;
 
     IDevice& m_device;
     std::array<std::array<uint8_t, BUFFER_SIZE>, BUFFER_COUNT> m_buffer;
@@ -299,20 +383,14 @@ private:
         m_displayListAssembler[0],
         m_displayListAssembler[1],
     };
-    Rasterizer m_rasterizer { !RenderConfig::USE_FLOAT_INTERPOLATION };
+    DeviceOutput m_output { *this };
+    ProcessorType m_processor { m_output };
 
-    const std::function<bool(const TransformedTriangle&)> drawTriangleLambda = [this](const TransformedTriangle& triangle)
-    {
-        return addTriangleCmd(triangle);
-    };
-    const std::function<bool(const StencilReg&)> setStencilBufferConfigLambda = [this](const StencilReg& stencilConf)
-    { return setStencilBufferConfig(stencilConf); };
+    std::array<Worker, RenderConfig::THREADED_RASTERIZATION_MAX_WORKERS> m_workers {};
+    std::size_t m_workerCount { 0 };
 
-    vertextransforming::VertexTransformingCalc<decltype(drawTriangleLambda), decltype(setStencilBufferConfigLambda)> m_vertexTransform {
-        {},
-        drawTriangleLambda,
-        setStencilBufferConfigLambda,
-    };
+    IThreadRunner* m_thread { nullptr };
+    QueueType m_queue {};
 };
 
 } // namespace rr
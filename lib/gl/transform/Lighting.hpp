@@ -19,6 +19,7 @@
 #define LIGHTING_HPP
 
 #include "Enums.hpp"
+#include "StateSnapshot.hpp"
 #include "Types.hpp"
 #include "math/Vec.hpp"
 #include <array>
@@ -141,6 +142,14 @@ public:
     void setColorMaterialTracking(const Face face, const ColorMaterialTracking material);
     void enableColorMaterial(const bool enable);
 
+    // Adds the state which is not part of the lighting data
+    void snapshotState(StateSnapshot& snapshot) const
+    {
+        snapshot.add(m_enableColorMaterial);
+        snapshot.add(m_colorMaterialTracking);
+        snapshot.add(m_colorMaterialFace);
+    }
+
 private:
     void enableColorMaterial(bool emission, bool ambient, bool diffuse, bool specular);
 
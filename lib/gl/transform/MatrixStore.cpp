@@ -257,4 +257,19 @@ std::size_t MatrixStore::getProjectionMatrixStackDepth()
     return PROJECTION_MATRIX_STACK_DEPTH;
 }
 
+void MatrixStore::snapshotState(StateSnapshot& snapshot) const
+{
+    snapshot.add(m_matrixMode);
+    snapshot.add(m_tmu);
+    snapshot.add(m_modelMatrixChanged);
+    snapshot.add(m_projectionMatrixChanged);
+    m_mStack.snapshotState(snapshot);
+    m_pStack.snapshotState(snapshot);
+    for (const Stack<Mat44, TEXTURE_MATRIX_STACK_DEPTH>& stack : m_tmStack)
+    {
+        stack.snapshotState(snapshot);
+    }
+    m_cStack.snapshotState(snapshot);
+}
+
 } // namespace rr::matrixstore
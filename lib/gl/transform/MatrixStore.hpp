@@ -20,6 +20,7 @@
 
 #include "RenderConfigs.hpp"
 #include "Stack.hpp"
+#include "StateSnapshot.hpp"
 #include "math/Mat44.hpp"
 #include "math/Vec.hpp"
 
@@ -81,6 +82,9 @@ public:
     static std::size_t getModelMatrixStackDepth();
     static std::size_t getProjectionMatrixStackDepth();
 
+    // Adds the state which is not part of the transform matrices data
+    void snapshotState(StateSnapshot& snapshot) const;
+
 private:
     static constexpr std::size_t MODEL_MATRIX_STACK_DEPTH { 16 };
     static constexpr std::size_t TEXTURE_MATRIX_STACK_DEPTH { 16 };
@@ -18,6 +18,7 @@
 #ifndef STACK_HPP
 #define STACK_HPP
 
+#include "StateSnapshot.hpp"
 #include <array>
 
 namespace rr
@@ -48,6 +49,16 @@ public:
         return false;
     }
 
+    // Adds the pushed elements
+    void snapshotState(StateSnapshot& snapshot) const
+    {
+        snapshot.add(m_stackPointer);
+        for (std::size_t i = 0; i < m_stackPointer; i++)
+        {
+            snapshot.addFloats(m_stack[i]);
+        }
+    }
+
 private:
     std::size_t m_stackPointer { 0 };
     std::array<T, DEPTH> m_stack {};
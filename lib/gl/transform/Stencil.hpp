@@ -19,6 +19,7 @@
 #define STENCIL_HPP_
 
 #include "Enums.hpp"
+#include "StateSnapshot.hpp"
 #include "math/Vec.hpp"
 #include "renderer/Rasterizer.hpp"
 #include "renderer/registers/StencilReg.hpp"
@@ -82,11 +83,23 @@ public:
     uint8_t getClearStencil() const { return stencilConfig().getClearStencil(); }
     uint8_t getStencilMask() const { return stencilConfig().getStencilMask(); }
 
-    void enableTwoSideStencil(const bool enable) { m_data.enableTwoSideStencil = enable; }
+    void enableTwoSideStencil(const bool enable)
+    {
+        m_data.enableTwoSideStencil = enable;
+        // The vertex transformation has written the config of one face. Restore the common config.
+        m_stencilDirty = true;
+    }
     void setStencilFace(const StencilFace face) { m_stencilFace = face; }
 
     bool update();
 
+    // Adds the state which is not part of the stencil data
+    void snapshotState(StateSnapshot& snapshot) const
+    {
+        snapshot.add(m_stencilFace);
+        snapshot.add(m_stencilConf.serialize());
+    }
+
 private:
     StencilReg& stencilConfig();
     const StencilReg& stencilConfig() const { return stencilConfig(); };
@@ -21,6 +21,8 @@
 #include "RenderConfigs.hpp"
 #include "math/Vec.hpp"
 #include <array>
+#include <cstdint>
+#include <tcb/span.hpp>
 
 namespace rr
 {
@@ -33,5 +35,32 @@ struct VertexParameter
     std::array<Vec4, RenderConfig::TMU_COUNT> tex;
 };
 
+// Tag of a vertex for the post transform vertex cache. The cache is managed by the sender of the vertices,
+// which decides if a vertex is a hit (see VertexCache). A STORE vertex is transformed and the result is
+// kept in the entry. A REUSE vertex takes the transformed result from the entry and has no attributes,
+// therefore the REUSE vertices are omitted in the vertex list which accompanies the tags.
+struct VertexCacheTag
+{
+    enum class Op : uint8_t
+    {
+        NONE,
+        STORE,
+        REUSE
+    };
+    Op op { Op::NONE };
+    uint16_t entry { 0 };
+
+    // Returns the number of vertices with attributes which belong to the tags
+    static std::size_t getVertexCount(const tcb::span<const VertexCacheTag> tags)
+    {
+        std::size_t count = 0;
+        for (const VertexCacheTag& tag : tags)
+        {
+            count += (tag.op != Op::REUSE) ? 1 : 0;
+        }
+        return count;
+    }
+};
+
 } // namespace rr
 #endif // TYPES_HPP
\ No newline at end of file
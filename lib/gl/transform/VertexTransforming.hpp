@@ -28,7 +28,11 @@
 #include "TexGen.hpp"
 #include "ViewPort.hpp"
 #include "math/Vec.hpp"
+#include "math/Vec4Soa.hpp"
+#include <algorithm>
+#include <array>
 #include <bitset>
+#include <cstdint>
 #include <tcb/span.hpp>
 
 namespace rr::vertextransforming
@@ -36,6 +40,58 @@ namespace rr::vertextransforming
 
 struct VertexTransformingData
 {
+    // Blocks of this struct which can be updated independently from each other
+    enum Block : std::size_t
+    {
+        TRANSFORM_MATRICES,
+        VIEW_PORT,
+        LIGHTING,
+        CULLING,
+        STENCIL,
+        TEX_GEN,
+        PRIMITIVE_ASSEMBLER,
+        TMU_ENABLED,
+        NORMALIZE_LIGHT_NORMAL,
+        CLIP_SPACE_VERTICES,
+        BLOCK_COUNT
+    };
+    using DirtyBits = std::bitset<BLOCK_COUNT>;
+
+    tcb::span<const uint8_t> getBlock(const std::size_t block) const
+    {
+        switch (block)
+        {
+        case TRANSFORM_MATRICES:
+            return toBytes(transformMatrices);
+        case VIEW_PORT:
+            return toBytes(viewPort);
+        case LIGHTING:
+            return toBytes(lighting);
+        case CULLING:
+            return toBytes(culling);
+        case STENCIL:
+            return toBytes(stencil);
+        case TEX_GEN:
+            return toBytes(texGen);
+        case PRIMITIVE_ASSEMBLER:
+            return toBytes(primitiveAssembler);
+        case TMU_ENABLED:
+            return toBytes(tmuEnabled);
+        case NORMALIZE_LIGHT_NORMAL:
+            return toBytes(normalizeLightNormal);
+        case CLIP_SPACE_VERTICES:
+            return toBytes(clipSpaceVertices);
+        default:
+            return {};
+        }
+    }
+
+    tcb::span<uint8_t> getBlock(const std::size_t block)
+    {
+        const tcb::span<const uint8_t> b = static_cast<const VertexTransformingData*>(this)->getBlock(block);
+        return { const_cast<uint8_t*>(b.data()), b.size() };
+    }
+
     matrixstore::TransformMatricesData transformMatrices {};
     viewport::ViewPortData viewPort {};
     lighting::LightingData lighting {};
@@ -45,6 +101,16 @@ struct VertexTransformingData
     primitiveassembler::PrimitiveAssemblerData primitiveAssembler {};
     std::bitset<RenderConfig::TMU_COUNT> tmuEnabled {};
     bool normalizeLightNormal {};
+    // The positions are already transformed into the clip space (compiled vertex arrays).
+    // Only used without lighting and texgen, which require the untransformed position.
+    bool clipSpaceVertices {};
+
+private:
+    template <typename T>
+    static tcb::span<const uint8_t> toBytes(const T& t)
+    {
+        return { reinterpret_cast<const uint8_t*>(&t), sizeof(T) };
+    }
 };
 
 template <typename TDrawTriangleFunc, typename TUpdateStencilFunc>
@@ -64,6 +130,90 @@ public:
     bool pushVertex(VertexParameter param)
     {
         transform(param);
+        return assemble(param);
+    }
+
+    // Pushes a vertex through the post transform vertex cache. The attributes of a REUSE vertex are not read.
+    bool pushVertex(const VertexParameter& param, const VertexCacheTag tag)
+    {
+        if constexpr (RenderConfig::VERTEX_CACHE_SIZE > 0)
+        {
+            switch (tag.op)
+            {
+            case VertexCacheTag::Op::REUSE:
+                return assemble(m_vertexCache[tag.entry]);
+            case VertexCacheTag::Op::STORE:
+                m_vertexCache[tag.entry] = param;
+                transform(m_vertexCache[tag.entry]);
+                return assemble(m_vertexCache[tag.entry]);
+            default:
+                break;
+            }
+        }
+        return pushVertex(param);
+    }
+
+    // Pushes a batch of vertices. The positions are transformed block wise with SIMD instructions,
+    // the results are the same as with pushVertex(). tags can be empty when the cache is not used,
+    // otherwise params contains only the vertices which are not tagged with REUSE.
+    bool pushVertices(const tcb::span<const VertexParameter> params, const tcb::span<const VertexCacheTag> tags)
+    {
+        bool ret = true;
+        const std::size_t count = tags.empty() ? params.size() : tags.size();
+        std::size_t paramPos = 0;
+        for (std::size_t i = 0; i < count; i += POSITION_BLOCK_SIZE)
+        {
+            const std::size_t blockSize = (std::min)(POSITION_BLOCK_SIZE, count - i);
+            const tcb::span<const VertexCacheTag> blockTags = tags.empty() ? tags : tags.subspan(i, blockSize);
+            const std::size_t paramCount = tags.empty() ? blockSize : VertexCacheTag::getVertexCount(blockTags);
+            ret = pushBlock(params.subspan(paramPos, paramCount), blockTags) && ret;
+            paramPos += paramCount;
+        }
+        return ret;
+    }
+
+    void* operator new(size_t, VertexTransformingCalc<TDrawTriangleFunc, TUpdateStencilFunc>* p) { return p; }
+
+private:
+    static constexpr std::size_t POSITION_BLOCK_SIZE { RenderConfig::THREADED_RASTERIZATION_VERTEX_BATCH_SIZE };
+
+    bool pushBlock(const tcb::span<const VertexParameter> params, const tcb::span<const VertexCacheTag> tags)
+    {
+        // Only the vertices with attributes are transformed, the REUSE vertices are already transformed
+        for (std::size_t i = 0; i < params.size(); i++)
+        {
+            m_positions.set(i, params[i].vertex);
+        }
+        if (!m_data.clipSpaceVertices)
+        {
+            m_positions.transform(m_data.transformMatrices.modelViewProjection, params.size());
+        }
+
+        bool ret = true;
+        std::size_t pos = 0;
+        const std::size_t count = tags.empty() ? params.size() : tags.size();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const VertexCacheTag::Op op = tags.empty() ? VertexCacheTag::Op::NONE : tags[i].op;
+            if ((RenderConfig::VERTEX_CACHE_SIZE > 0) && (op == VertexCacheTag::Op::REUSE))
+            {
+                ret = assemble(m_vertexCache[tags[i].entry]) && ret;
+                continue;
+            }
+            VertexParameter tmp;
+            VertexParameter& param = ((RenderConfig::VERTEX_CACHE_SIZE > 0) && (op == VertexCacheTag::Op::STORE))
+                ? m_vertexCache[tags[i].entry]
+                : tmp;
+            param = params[pos];
+            transformAttributes(param);
+            param.vertex = m_positions.get(pos++);
+            ret = assemble(param) && ret;
+        }
+        return ret;
+    }
+
+    bool assemble(const VertexParameter& param)
+    {
         m_primitiveAssembler.pushParameter(param);
 
         const tcb::span<const primitiveassembler::PrimitiveAssemblerCalc::Triangle> triangles = m_primitiveAssembler.getPrimitive();
@@ -81,10 +231,17 @@ public:
         return true;
     }
 
-    void* operator new(size_t, VertexTransformingCalc<TDrawTriangleFunc, TUpdateStencilFunc>* p) { return p; }
-
-private:
     void transform(VertexParameter& parameter)
+    {
+        transformAttributes(parameter);
+        if (!m_data.clipSpaceVertices)
+        {
+            parameter.vertex = m_data.transformMatrices.modelViewProjection.transform(parameter.vertex);
+        }
+    }
+
+    // Transforms everything except the position. Expects the position in object coordinates.
+    void transformAttributes(VertexParameter& parameter)
     {
         for (std::size_t tu = 0; tu < RenderConfig::TMU_COUNT; tu++)
         {
@@ -113,7 +270,6 @@ private:
             const Vec4 c = parameter.color;
             lighting::LightingCalc { m_data.lighting }.calculateLights(parameter.color, c, vl, normal);
         }
-        parameter.vertex = m_data.transformMatrices.modelViewProjection.transform(parameter.vertex);
     }
 
     bool drawClippedTriangleList(tcb::span<VertexParameter> list)
@@ -245,6 +401,13 @@ private:
         m_data.viewPort,
         m_data.primitiveAssembler,
     };
+
+    // Transformed vertices of the post transform vertex cache. The entries are only valid till the next
+    // vertex context, which starts a new draw call.
+    std::array<VertexParameter, RenderConfig::VERTEX_CACHE_SIZE> m_vertexCache;
+
+    // Positions of the current block of pushVertices()
+    Vec4Soa<POSITION_BLOCK_SIZE> m_positions;
 };
 
 } // namespace rr::vertextransforming
@@ -0,0 +1,139 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef ATTRIBUTEFETCHER_HPP_
+#define ATTRIBUTEFETCHER_HPP_
+
+#include "math/Vec.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <tcb/span.hpp>
+#include <type_traits>
+
+namespace rr
+{
+
+// Fetches one vertex attribute for a run of vertices. The kernel is specialized for the type and the size of
+// the attribute array and selected once per draw call (see RenderObj), therefore the loop over the vertices
+// contains no branches. A disabled array uses a kernel which writes the current value of the attribute.
+template <typename TVec>
+class AttributeFetcher
+{
+public:
+    AttributeFetcher() = default;
+
+    // Fetches the attribute of the vertices at indices. The n-th attribute is written to dst + (n * dstStride).
+    // dstStride is in bytes, which allows to write directly into a member of an array of structs.
+    void fetch(const tcb::span<const std::size_t> indices, TVec* dst, const std::size_t dstStride) const
+    {
+        m_kernel(*this, indices, reinterpret_cast<uint8_t*>(dst), dstStride);
+    }
+
+    // Fetcher for an array with elements of type T. Components which are not part of the array are
+    // taken from the homogeneous vector. All components of integer arrays are multiplied with scale.
+    template <typename T>
+    static AttributeFetcher createArray(const void* arr, const std::size_t stride, const std::size_t size, const float scale)
+    {
+        AttributeFetcher f {};
+        f.m_array = static_cast<const uint8_t*>(arr);
+        f.m_stride = (stride == 0) ? (size * sizeof(T)) : stride;
+        f.m_scale = scale;
+        f.m_value = TVec::createHomogeneous();
+        f.m_value *= scale;
+        if (!arr)
+        {
+            f.m_kernel = &valueKernel;
+            return f;
+        }
+        switch (size)
+        {
+        case 0:
+            f.m_kernel = &arrayKernel<T, 0>;
+            break;
+        case 1:
+            f.m_kernel = &arrayKernel<T, 1>;
+            break;
+        case 2:
+            f.m_kernel = &arrayKernel<T, 2>;
+            break;
+        case 3:
+            f.m_kernel = &arrayKernel<T, 3>;
+            break;
+        default:
+            f.m_kernel = &arrayKernel<T, 4>;
+            break;
+        }
+        return f;
+    }
+
+    // Fetcher which returns value for every vertex
+    static AttributeFetcher createValue(const TVec& value)
+    {
+        AttributeFetcher f {};
+        f.m_value = value;
+        f.m_kernel = &valueKernel;
+        return f;
+    }
+
+private:
+    static constexpr std::size_t VEC_SIZE { sizeof(TVec) / sizeof(float) };
+    using Kernel = void (*)(const AttributeFetcher&, tcb::span<const std::size_t>, uint8_t*, std::size_t);
+
+    template <typename T, std::size_t Size>
+    static void arrayKernel(const AttributeFetcher& f, const tcb::span<const std::size_t> indices, uint8_t* dst, const std::size_t dstStride)
+    {
+        // Larger arrays are truncated to the size of the vector
+        constexpr std::size_t size = (Size < VEC_SIZE) ? Size : VEC_SIZE;
+        for (const std::size_t index : indices)
+        {
+            const T* src = reinterpret_cast<const T*>(f.m_array + (index * f.m_stride));
+            TVec& vec = *reinterpret_cast<TVec*>(dst);
+            vec = f.m_value;
+            for (std::size_t i = 0; i < size; i++)
+            {
+                if constexpr (std::is_same<T, float>::value)
+                {
+                    // Floats are used as they are
+                    vec[i] = src[i];
+                }
+                else
+                {
+                    vec[i] = static_cast<float>(src[i]) * f.m_scale;
+                }
+            }
+            dst += dstStride;
+        }
+    }
+
+    static void valueKernel(const AttributeFetcher& f, const tcb::span<const std::size_t> indices, uint8_t* dst, const std::size_t dstStride)
+    {
+        for (std::size_t i = 0; i < indices.size(); i++)
+        {
+            *reinterpret_cast<TVec*>(dst) = f.m_value;
+            dst += dstStride;
+        }
+    }
+
+    Kernel m_kernel { &valueKernel };
+    const uint8_t* m_array { nullptr };
+    std::size_t m_stride { 0 };
+    float m_scale { 1.0f };
+    TVec m_value { TVec::createHomogeneous() };
+};
+
+} // namespace rr
+#endif // ATTRIBUTEFETCHER_HPP_
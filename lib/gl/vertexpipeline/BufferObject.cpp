@@ -0,0 +1,151 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "BufferObject.hpp"
+#include <cstring>
+
+namespace rr
+{
+
+void BufferObject::setData(const void* data, const std::size_t size, const Usage usage)
+{
+    m_data.resize(size);
+    if (data)
+    {
+        std::memcpy(m_data.data(), data, size);
+    }
+    m_usage = usage;
+    m_mapped = false;
+    invalidate();
+}
+
+bool BufferObject::setSubData(const std::size_t offset, const std::size_t size, const void* data)
+{
+    if ((offset > m_data.size()) || (size > (m_data.size() - offset)))
+    {
+        return false;
+    }
+    std::memcpy(m_data.data() + offset, data, size);
+    invalidate();
+    return true;
+}
+
+bool BufferObject::getSubData(const std::size_t offset, const std::size_t size, void* data) const
+{
+    if ((offset > m_data.size()) || (size > (m_data.size() - offset)))
+    {
+        return false;
+    }
+    std::memcpy(data, m_data.data() + offset, size);
+    return true;
+}
+
+void* BufferObject::map()
+{
+    if (m_mapped)
+    {
+        return nullptr;
+    }
+    m_mapped = true;
+    return m_data.data();
+}
+
+bool BufferObject::unmap()
+{
+    if (!m_mapped)
+    {
+        return false;
+    }
+    m_mapped = false;
+    invalidate();
+    return true;
+}
+
+std::size_t BufferObject::getElementCount(const Type type, const std::size_t size, const std::size_t stride, const std::size_t offset) const
+{
+    const std::size_t elementSize = getTypeSize(type) * size;
+    if ((offset > m_data.size()) || (elementSize > (m_data.size() - offset)))
+    {
+        return 0;
+    }
+    // The last element does not require the full stride
+    return (((m_data.size() - offset) - elementSize) / ((stride == 0) ? elementSize : stride)) + 1;
+}
+
+std::optional<BufferObject::IndexRange> BufferObject::getIndexRange(const Type type, const std::size_t offset, const std::size_t count)
+{
+    const auto key = std::make_tuple(type, offset, count);
+    if (m_usage == Usage::STATIC)
+    {
+        const auto it = m_indexRanges.find(key);
+        if (it != m_indexRanges.end())
+        {
+            return it->second;
+        }
+    }
+
+    const std::size_t typeSize = getTypeSize(type);
+    if ((offset > m_data.size()) || (count > ((m_data.size() - offset) / typeSize)))
+    {
+        return std::nullopt;
+    }
+
+    const IndexRange range = scanIndexRange(type, m_data.data() + offset, count);
+    if (m_usage == Usage::STATIC)
+    {
+        m_indexRanges[key] = range;
+    }
+    return range;
+}
+
+BufferObject::IndexRange BufferObject::scanIndexRange(const Type type, const void* indices, const std::size_t count)
+{
+    switch (type)
+    {
+    case Type::BYTE:
+    case Type::UNSIGNED_BYTE:
+        return scanIndexRange<uint8_t>(indices, count);
+    case Type::SHORT:
+    case Type::UNSIGNED_SHORT:
+        return scanIndexRange<uint16_t>(indices, count);
+    default:
+        return scanIndexRange<uint32_t>(indices, count);
+    }
+}
+
+std::size_t BufferObject::getTypeSize(const Type type)
+{
+    switch (type)
+    {
+    case Type::BYTE:
+    case Type::UNSIGNED_BYTE:
+        return 1;
+    case Type::SHORT:
+    case Type::UNSIGNED_SHORT:
+        return 2;
+    default:
+        return 4;
+    }
+}
+
+void BufferObject::invalidate()
+{
+    m_convertedArrays.clear();
+    m_indexRanges.clear();
+}
+
+} // namespace rr
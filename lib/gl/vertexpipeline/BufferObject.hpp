@@ -0,0 +1,156 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef BUFFEROBJECT_HPP_
+#define BUFFEROBJECT_HPP_
+
+#include "Enums.hpp"
+#include "math/Vec.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <optional>
+#include <tcb/span.hpp>
+#include <tuple>
+#include <vector>
+
+namespace rr
+{
+
+// Storage of a buffer object (ARB_vertex_buffer_object). The data is kept in the driver, therefore the arrays
+// of a buffer are not client memory. For static buffers the results which only depend on the data are cached:
+// The attribute arrays converted to floats (see RenderObj) and the validated ranges of the indices. The format
+// of an array is only known at the draw, therefore the cache is filled by the first draw which uses it.
+class BufferObject
+{
+public:
+    enum class Usage
+    {
+        STREAM,
+        STATIC,
+        DYNAMIC
+    };
+
+    struct IndexRange
+    {
+        uint32_t min;
+        uint32_t max;
+    };
+
+    // Replaces the data. data can be a nullptr, then the buffer is cleared.
+    void setData(const void* data, const std::size_t size, const Usage usage);
+
+    // Updates a part of the data. Returns false when the range is outside of the buffer.
+    bool setSubData(const std::size_t offset, const std::size_t size, const void* data);
+
+    // Returns false when the range is outside of the buffer
+    bool getSubData(const std::size_t offset, const std::size_t size, void* data) const;
+
+    // Maps the data. The caches are invalidated when the buffer is unmapped. Returns a nullptr when it is already mapped.
+    void* map();
+    bool unmap();
+    bool isMapped() const { return m_mapped; }
+
+    std::size_t getSize() const { return m_data.size(); }
+    Usage getUsage() const { return m_usage; }
+
+    // Returns a pointer to the data at offset or a nullptr when the offset is outside of the buffer
+    const uint8_t* getData(const std::size_t offset) const { return (offset < m_data.size()) ? (m_data.data() + offset) : nullptr; }
+
+    // Number of elements of an array which starts at offset. A stride of 0 means tightly packed elements.
+    std::size_t getElementCount(const Type type, const std::size_t size, const std::size_t stride, const std::size_t offset) const;
+
+    // Returns the range of count indices of type at offset. Returns nothing when the indices exceed the buffer.
+    std::optional<IndexRange> getIndexRange(const Type type, const std::size_t offset, const std::size_t count);
+
+    // Returns the array at offset converted to Vec4. The array is converted with convert(tcb::span<Vec4> dst), which
+    // gets the storage for all elements of the array. The conversion is kept till the data of the buffer changes.
+    template <typename TConvert>
+    tcb::span<const Vec4> getConvertedArray(const Type type, const std::size_t size, const std::size_t stride, const std::size_t offset, const float scale, const TConvert& convert)
+    {
+        const ArrayKey key { type, size, stride, offset, scale };
+        for (const ConvertedArray& array : m_convertedArrays)
+        {
+            if (array.key == key)
+            {
+                return array.data;
+            }
+        }
+        m_convertedArrays.push_back({ key, std::vector<Vec4>(getElementCount(type, size, stride, offset)) });
+        convert(tcb::span<Vec4> { m_convertedArrays.back().data });
+        return m_convertedArrays.back().data;
+    }
+
+    // Returns the range of count indices of type in indices
+    static IndexRange scanIndexRange(const Type type, const void* indices, const std::size_t count);
+
+    static std::size_t getTypeSize(const Type type);
+
+private:
+    struct ArrayKey
+    {
+        Type type;
+        std::size_t size;
+        std::size_t stride;
+        std::size_t offset;
+        float scale;
+
+        bool operator==(const ArrayKey& rhs) const
+        {
+            return (type == rhs.type) && (size == rhs.size) && (stride == rhs.stride) && (offset == rhs.offset) && (scale == rhs.scale);
+        }
+    };
+
+    struct ConvertedArray
+    {
+        ArrayKey key;
+        std::vector<Vec4> data;
+    };
+
+    template <typename T>
+    static IndexRange scanIndexRange(const void* indices, const std::size_t count)
+    {
+        if (count == 0)
+        {
+            return { 0, 0 };
+        }
+        // The indices of a buffer are not necessarily aligned
+        IndexRange range { UINT32_MAX, 0 };
+        const uint8_t* data = static_cast<const uint8_t*>(indices);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            T index;
+            std::memcpy(&index, data + (i * sizeof(T)), sizeof(T));
+            range.min = (std::min)(range.min, static_cast<uint32_t>(index));
+            range.max = (std::max)(range.max, static_cast<uint32_t>(index));
+        }
+        return range;
+    }
+
+    void invalidate();
+
+    std::vector<uint8_t> m_data {};
+    Usage m_usage { Usage::STATIC };
+    bool m_mapped { false };
+    std::vector<ConvertedArray> m_convertedArrays {};
+    std::map<std::tuple<Type, std::size_t, std::size_t>, IndexRange> m_indexRanges {};
+};
+
+} // namespace rr
+#endif // BUFFEROBJECT_HPP_
@@ -0,0 +1,78 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef BUFFEROBJECTS_HPP_
+#define BUFFEROBJECTS_HPP_
+
+#include "BufferObject.hpp"
+#include <cstdint>
+#include <map>
+#include <set>
+
+namespace rr
+{
+
+// Name space of the buffer objects. The name 0 is reserved and means no buffer.
+class BufferObjects
+{
+public:
+    // Returns a name which is not used, the buffer is created when it is bound the first time
+    uint32_t genName()
+    {
+        while ((m_nextName == 0) || isBuffer(m_nextName) || m_reserved.count(m_nextName))
+        {
+            m_nextName++;
+        }
+        m_reserved.insert(m_nextName);
+        return m_nextName++;
+    }
+
+    // Returns the buffer of name and creates it, when it does not exist. Returns a nullptr for the name 0.
+    BufferObject* getOrCreate(const uint32_t name)
+    {
+        if (name == 0)
+        {
+            return nullptr;
+        }
+        m_reserved.erase(name);
+        return &m_buffers[name];
+    }
+
+    BufferObject* get(const uint32_t name)
+    {
+        const auto it = m_buffers.find(name);
+        return (it != m_buffers.end()) ? &it->second : nullptr;
+    }
+
+    bool isBuffer(const uint32_t name) const { return m_buffers.find(name) != m_buffers.end(); }
+
+    void remove(const uint32_t name)
+    {
+        m_buffers.erase(name);
+        m_reserved.erase(name);
+    }
+
+private:
+    // The map keeps the addresses of the buffers stable, the render objects point to them
+    std::map<uint32_t, BufferObject> m_buffers {};
+    // Generated names which are not yet bound
+    std::set<uint32_t> m_reserved {};
+    uint32_t m_nextName { 1 };
+};
+
+} // namespace rr
+#endif // BUFFEROBJECTS_HPP_
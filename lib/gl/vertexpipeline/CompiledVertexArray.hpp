@@ -0,0 +1,152 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef COMPILEDVERTEXARRAY_HPP_
+#define COMPILEDVERTEXARRAY_HPP_
+
+#include "RenderObj.hpp"
+#include "math/Mat44.hpp"
+#include "math/Vec.hpp"
+#include "transform/VertexTransforming.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <string.h>
+#include <vector>
+
+namespace rr
+{
+
+// Implements GL_EXT_compiled_vertex_array. The application promises that the locked range of the vertex array
+// does not change till it is unlocked. Engines like the id tech ones lock the positions and draw them several
+// times with different colors and texture coordinates (multi pass shaders). The positions of the locked range
+// are therefore transformed only once into the clip space and reused by the following draws, as long as the
+// model view projection matrix stays the same.
+class CompiledVertexArray
+{
+public:
+    // Locks the range. obj is the current array state, only the vertex array enabled at this time is locked.
+    void lock(const std::size_t first, const std::size_t count, const RenderObj& obj)
+    {
+        m_locked = true;
+        m_first = first;
+        m_count = count;
+        m_array = getArrayState(obj);
+        m_valid = m_array.enabled;
+        if (m_positions.size() < count)
+        {
+            m_positions.resize(count);
+            m_generations.resize(count, 0);
+        }
+        invalidate();
+    }
+
+    void unlock()
+    {
+        m_locked = false;
+        m_valid = false;
+    }
+
+    bool isLocked() const { return m_locked; }
+    std::size_t getFirst() const { return m_first; }
+    std::size_t getCount() const { return m_count; }
+
+    // Checks if the positions of a draw can be taken from this array. This requires the locked vertex array and a
+    // transformation which only uses the position for the model view projection (no lighting and no texgen).
+    bool prepare(const RenderObj& obj, const vertextransforming::VertexTransformingData& ctx)
+    {
+        if (!m_valid || !(getArrayState(obj) == m_array) || ctx.lighting.lightingEnabled)
+        {
+            return false;
+        }
+        for (std::size_t tu = 0; tu < RenderConfig::TMU_COUNT; tu++)
+        {
+            const texgen::TexGenData& texGen = ctx.texGen[tu];
+            if (ctx.tmuEnabled[tu] && (texGen.texGenEnableS || texGen.texGenEnableT || texGen.texGenEnableR))
+            {
+                return false;
+            }
+        }
+        const Mat44& mvp = ctx.transformMatrices.modelViewProjection;
+        if (memcmp(&mvp, &m_modelViewProjection, sizeof(Mat44)) != 0)
+        {
+            m_modelViewProjection = mvp;
+            invalidate();
+        }
+        return true;
+    }
+
+    // Returns the position of the vertex in clip coordinates. Indices outside of the locked range are transformed
+    // without caching them.
+    Vec4 getPosition(const RenderObj& obj, const std::size_t index)
+    {
+        const std::size_t i = index - m_first;
+        if ((index < m_first) || (i >= m_count))
+        {
+            return m_modelViewProjection.transform(obj.getVertex(index));
+        }
+        if (m_generations[i] != m_generation)
+        {
+            m_positions[i] = m_modelViewProjection.transform(obj.getVertex(index));
+            m_generations[i] = m_generation;
+        }
+        return m_positions[i];
+    }
+
+private:
+    struct ArrayState
+    {
+        bool enabled { false };
+        const void* pointer { nullptr };
+        Type type { Type::FLOAT };
+        std::size_t stride { 0 };
+        std::size_t size { 0 };
+
+        bool operator==(const ArrayState& rhs) const
+        {
+            return (enabled == rhs.enabled) && (pointer == rhs.pointer) && (type == rhs.type) && (stride == rhs.stride) && (size == rhs.size);
+        }
+    };
+
+    static ArrayState getArrayState(const RenderObj& obj)
+    {
+        return { obj.vertexArrayEnabled(), obj.getVertexPointer(), obj.getVertexType(), obj.getVertexStride(), obj.getVertexSize() };
+    }
+
+    // Invalidates all cached positions without touching them
+    void invalidate()
+    {
+        m_generation++;
+        if (m_generation == 0)
+        {
+            std::fill(m_generations.begin(), m_generations.end(), 0);
+            m_generation = 1;
+        }
+    }
+
+    bool m_locked { false };
+    bool m_valid { false };
+    std::size_t m_first { 0 };
+    std::size_t m_count { 0 };
+    ArrayState m_array {};
+    Mat44 m_modelViewProjection {};
+    std::vector<Vec4> m_positions {};
+    std::vector<uint32_t> m_generations {};
+    uint32_t m_generation { 0 };
+};
+
+} // namespace rr
+#endif // COMPILEDVERTEXARRAY_HPP_
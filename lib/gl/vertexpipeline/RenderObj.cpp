@@ -16,6 +16,7 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "RenderObj.hpp"
+#include <algorithm>
 #include <functional>
 #include <spdlog/spdlog.h>
 
@@ -35,70 +36,140 @@ bool RenderObj::isLine() const
     return (getDrawMode() == DrawMode::LINES) || (getDrawMode() == DrawMode::LINE_LOOP) || (getDrawMode() == DrawMode::LINE_STRIP);
 }
 
-Vec4 RenderObj::getTexCoord(const std::size_t tmu, const std::size_t index) const
+AttributeFetcher<Vec4> RenderObj::getVertexFetcher() const
+{
+    return createFetcher<Vec4>(m_vertexType, m_vertexBuffer, m_vertexPointer, m_vertexStride, m_vertexSize, 1.0f);
+}
+
+AttributeFetcher<Vec4> RenderObj::getTexCoordFetcher(const std::size_t tmu) const
 {
     if (m_texCoordArrayEnabled[tmu])
     {
-        return getFromArray<Vec4>(m_texCoordType[tmu], m_texCoordPointer[tmu], m_texCoordStride[tmu], m_texCoordSize[tmu], index);
+        return createFetcher<Vec4>(m_texCoordType[tmu], m_texCoordBuffer[tmu], m_texCoordPointer[tmu], m_texCoordStride[tmu], m_texCoordSize[tmu], 1.0f);
     }
-    return m_texCoord[tmu];
+    return AttributeFetcher<Vec4>::createValue(m_texCoord[tmu]);
 }
 
-Vec4 RenderObj::getColor(const std::size_t index) const
+AttributeFetcher<Vec4> RenderObj::getColorFetcher() const
 {
     if (colorArrayEnabled())
     {
-        Vec4 vec = getFromArray<Vec4>(m_colorType, m_colorPointer, m_colorStride, m_colorSize, index);
         switch (m_colorType)
         {
         case Type::UNSIGNED_BYTE:
         case Type::UNSIGNED_SHORT:
         case Type::UNSIGNED_INT:
             // Map unsigned values to 0.0 .. 1.0
-            vec *= 1.0f / 255.0f;
-            break;
+            return createFetcher<Vec4>(m_colorType, m_colorBuffer, m_colorPointer, m_colorStride, m_colorSize, 1.0f / 255.0f);
         case Type::BYTE:
         case Type::SHORT:
             // Map signed values to -1.0 .. 1.0
-            vec *= 1.0f / 127.0f;
-            break;
+            return createFetcher<Vec4>(m_colorType, m_colorBuffer, m_colorPointer, m_colorStride, m_colorSize, 1.0f / 127.0f);
         default:
             // Other types like floats can be used as they are
-            break;
+            return createFetcher<Vec4>(m_colorType, m_colorBuffer, m_colorPointer, m_colorStride, m_colorSize, 1.0f);
         }
-        return vec;
     }
-    return m_vertexColor;
+    return AttributeFetcher<Vec4>::createValue(m_vertexColor);
 }
 
-Vec3 RenderObj::getNormal(const std::size_t index) const
+AttributeFetcher<Vec3> RenderObj::getNormalFetcher() const
 {
     if (normalArrayEnabled())
     {
-        return getFromArray<Vec3>(m_normalType, m_normalPointer, m_normalStride, 3, index);
+        return createFetcher<Vec3>(m_normalType, m_normalBuffer, m_normalPointer, m_normalStride, 3, 1.0f);
     }
-    return m_normal;
+    return AttributeFetcher<Vec3>::createValue(m_normal);
 }
 
-std::size_t RenderObj::getIndex(const std::size_t index) const
+std::size_t RenderObj::getBufferedVertexCount() const
+{
+    std::size_t count = SIZE_MAX;
+    const auto clamp = [&](const bool enabled, const BufferObject* buffer, const Type type, const std::size_t size, const std::size_t stride, const void* ptr)
+    {
+        if (enabled && buffer)
+        {
+            count = (std::min)(count, buffer->getElementCount(type, size, stride, reinterpret_cast<std::size_t>(ptr)));
+        }
+    };
+    clamp(m_vertexArrayEnabled, m_vertexBuffer, m_vertexType, m_vertexSize, m_vertexStride, m_vertexPointer);
+    clamp(m_colorArrayEnabled, m_colorBuffer, m_colorType, m_colorSize, m_colorStride, m_colorPointer);
+    clamp(m_normalArrayEnabled, m_normalBuffer, m_normalType, 3, m_normalStride, m_normalPointer);
+    for (std::size_t tmu = 0; tmu < MAX_TMU_COUNT; tmu++)
+    {
+        clamp(m_texCoordArrayEnabled[tmu], m_texCoordBuffer[tmu], m_texCoordType[tmu], m_texCoordSize[tmu], m_texCoordStride[tmu], m_texCoordPointer[tmu]);
+    }
+    return count;
+}
+
+bool RenderObj::isBufferMapped() const
+{
+    const auto mapped = [](const bool enabled, const BufferObject* buffer)
+    {
+        return enabled && buffer && buffer->isMapped();
+    };
+    bool ret = mapped(m_vertexArrayEnabled, m_vertexBuffer)
+        || mapped(m_colorArrayEnabled, m_colorBuffer)
+        || mapped(m_normalArrayEnabled, m_normalBuffer)
+        || mapped(m_indicesEnabled, m_indicesBuffer);
+    for (std::size_t tmu = 0; tmu < MAX_TMU_COUNT; tmu++)
+    {
+        ret = ret || mapped(m_texCoordArrayEnabled[tmu], m_texCoordBuffer[tmu]);
+    }
+    return ret;
+}
+
+void RenderObj::unbindBuffer(const BufferObject* obj)
+{
+    const auto unbind = [&](BufferObject*& buffer, const void*& ptr)
+    {
+        if (buffer == obj)
+        {
+            buffer = nullptr;
+            ptr = nullptr;
+        }
+    };
+    unbind(m_vertexBuffer, m_vertexPointer);
+    unbind(m_colorBuffer, m_colorPointer);
+    unbind(m_normalBuffer, m_normalPointer);
+    unbind(m_indicesBuffer, m_indicesPointer);
+    for (std::size_t tmu = 0; tmu < MAX_TMU_COUNT; tmu++)
+    {
+        unbind(m_texCoordBuffer[tmu], m_texCoordPointer[tmu]);
+    }
+}
+
+void RenderObj::getIndices(const std::size_t first, const tcb::span<std::size_t> indices) const
 {
     if (m_indicesEnabled)
     {
+        const void* indicesPointer = resolvePointer(m_indicesBuffer, m_indicesPointer);
         switch (m_indicesType)
         {
         case Type::BYTE:
         case Type::UNSIGNED_BYTE:
-            return static_cast<const uint8_t*>(m_indicesPointer)[index];
+            copyIndices(static_cast<const uint8_t*>(indicesPointer) + first, indices);
+            return;
         case Type::SHORT:
         case Type::UNSIGNED_SHORT:
-            return static_cast<const uint16_t*>(m_indicesPointer)[index];
+            copyIndices(static_cast<const uint16_t*>(indicesPointer) + first, indices);
+            return;
         case Type::UNSIGNED_INT:
-            return static_cast<const uint32_t*>(m_indicesPointer)[index];
+            copyIndices(static_cast<const uint32_t*>(indicesPointer) + first, indices);
+            return;
         default:
-            return index;
+            break;
         }
+        for (std::size_t i = 0; i < indices.size(); i++)
+        {
+            indices[i] = first + i;
+        }
+        return;
+    }
+    for (std::size_t i = 0; i < indices.size(); i++)
+    {
+        indices[i] = first + i + m_arrayOffset;
     }
-    return index + m_arrayOffset;
 }
 
 const char* RenderObj::drawModeToString(const DrawMode drawMode) const
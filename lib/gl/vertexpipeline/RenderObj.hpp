@@ -18,12 +18,15 @@
 #ifndef RENDEROBJ_HPP
 #define RENDEROBJ_HPP
 
+#include "AttributeFetcher.hpp"
+#include "BufferObject.hpp"
 #include "Enums.hpp"
 #include "RenderConfigs.hpp"
 #include "math/Vec.hpp"
 #include <array>
 #include <bitset>
 #include <optional>
+#include <tcb/span.hpp>
 
 namespace rr
 {
@@ -37,17 +40,33 @@ public:
     void logCurrentConfig() const;
 
     inline bool vertexArrayEnabled() const { return m_vertexArrayEnabled; }
-    Vec4 getVertex(const std::size_t index) const { return getFromArray<Vec4>(m_vertexType, m_vertexPointer, m_vertexStride, m_vertexSize, index); }
+    Vec4 getVertex(const std::size_t index) const { return getFromArray<Vec4>(m_vertexType, getVertexPointer(), m_vertexStride, m_vertexSize, index); }
+    inline const void* getVertexPointer() const { return resolvePointer(m_vertexBuffer, m_vertexPointer); }
+    inline Type getVertexType() const { return m_vertexType; }
+    inline std::size_t getVertexStride() const { return m_vertexStride; }
+    inline std::size_t getVertexSize() const { return m_vertexSize; }
     inline const std::bitset<MAX_TMU_COUNT>& texCoordArrayEnabled() const { return m_texCoordArrayEnabled; }
-    Vec4 getTexCoord(const std::size_t tmu, const std::size_t index) const;
     inline bool colorArrayEnabled() const { return m_colorArrayEnabled; }
-    Vec4 getColor(const std::size_t index) const;
     inline const Vec4& getVertexColor() const { return m_vertexColor; }
     inline bool normalArrayEnabled() const { return m_normalArrayEnabled; }
-    Vec3 getNormal(const std::size_t index) const;
     bool isLine() const;
 
-    std::size_t getIndex(const std::size_t index) const;
+    // Fetchers for the attributes of the current array configuration. Select them once per draw call.
+    AttributeFetcher<Vec4> getVertexFetcher() const;
+    AttributeFetcher<Vec4> getTexCoordFetcher(const std::size_t tmu) const;
+    AttributeFetcher<Vec4> getColorFetcher() const;
+    AttributeFetcher<Vec3> getNormalFetcher() const;
+
+    // Returns the number of vertices which can be fetched from the enabled arrays which are stored in buffer objects
+    std::size_t getBufferedVertexCount() const;
+    // Checks if one of the buffers of the enabled arrays or the indices is mapped
+    bool isBufferMapped() const;
+    // Detaches all arrays from obj, for instance when obj is deleted
+    void unbindBuffer(const BufferObject* obj);
+
+    inline bool indicesEnabled() const { return m_indicesEnabled; }
+    // Writes the array indices of the vertices first .. first + indices.size() into indices
+    void getIndices(const std::size_t first, const tcb::span<std::size_t> indices) const;
     inline DrawMode getDrawMode() const { return m_drawMode; }
     inline std::size_t getCount() const { return m_count; }
     inline void reset() { m_fetchCount = 0; }
@@ -59,18 +78,21 @@ public:
     void setVertexType(Type type) { m_vertexType = type; }
     void setVertexStride(std::size_t stride) { m_vertexStride = stride; }
     void setVertexPointer(const void* ptr) { m_vertexPointer = ptr; }
+    void setVertexBuffer(BufferObject* buffer) { m_vertexBuffer = buffer; }
 
     void enableTexCoordArray(const std::size_t tmu, bool enable) { m_texCoordArrayEnabled[tmu] = enable; }
     void setTexCoordSize(const std::size_t tmu, std::size_t size) { m_texCoordSize[tmu] = size; }
     void setTexCoordType(const std::size_t tmu, Type type) { m_texCoordType[tmu] = type; }
     void setTexCoordStride(const std::size_t tmu, std::size_t stride) { m_texCoordStride[tmu] = stride; }
     void setTexCoordPointer(const std::size_t tmu, const void* ptr) { m_texCoordPointer[tmu] = ptr; }
+    void setTexCoordBuffer(const std::size_t tmu, BufferObject* buffer) { m_texCoordBuffer[tmu] = buffer; }
     void setTexCoord(const std::size_t tmu, const Vec4& texCoord) { m_texCoord[tmu] = texCoord; }
 
     void enableNormalArray(bool enable) { m_normalArrayEnabled = enable; }
     void setNormalType(Type type) { m_normalType = type; }
     void setNormalStride(std::size_t stride) { m_normalStride = stride; }
     void setNormalPointer(const void* ptr) { m_normalPointer = ptr; }
+    void setNormalBuffer(BufferObject* buffer) { m_normalBuffer = buffer; }
     void setNormal(const Vec3& normal) { m_normal = normal; }
 
     void enableColorArray(bool enable) { m_colorArrayEnabled = enable; }
@@ -78,6 +100,7 @@ public:
     void setColorType(Type type) { m_colorType = type; }
     void setColorStride(std::size_t stride) { m_colorStride = stride; }
     void setColorPointer(const void* ptr) { m_colorPointer = ptr; }
+    void setColorBuffer(BufferObject* buffer) { m_colorBuffer = buffer; }
     void setVertexColor(const Vec4& color) { m_vertexColor = color; }
 
     void setDrawMode(DrawMode mode) { m_drawMode = mode; }
@@ -86,9 +109,71 @@ public:
     void setCount(std::size_t count) { m_count = count; }
     void setIndicesType(Type type) { m_indicesType = type; }
     void setIndicesPointer(const void* ptr) { m_indicesPointer = ptr; }
+    void setIndicesBuffer(BufferObject* buffer) { m_indicesBuffer = buffer; }
     void setArrayOffset(std::size_t offset) { m_arrayOffset = offset; }
 
 private:
+    // With a buffer object, the pointer of an array is the offset into the buffer
+    static const void* resolvePointer(const BufferObject* buffer, const void* ptr)
+    {
+        return buffer ? buffer->getData(reinterpret_cast<std::size_t>(ptr)) : ptr;
+    }
+
+    template <typename TVec>
+    static AttributeFetcher<TVec> createFetcher(const Type type, BufferObject* buffer, const void* ptr, const std::size_t stride, const std::size_t size, const float scale)
+    {
+        if (buffer && (buffer->getUsage() == BufferObject::Usage::STATIC))
+        {
+            // Static buffers are converted once into an array of floats, which then requires the fastest kernel
+            const std::size_t offset = reinterpret_cast<std::size_t>(ptr);
+            const tcb::span<const Vec4> converted = buffer->getConvertedArray(type, size, stride, offset, scale, [&](const tcb::span<Vec4> dst)
+                {
+                    std::array<std::size_t, 64> indices;
+                    const AttributeFetcher<Vec4> fetcher = createFetcher<Vec4>(type, buffer->getData(offset), stride, size, scale);
+                    for (std::size_t i = 0; i < dst.size(); i += indices.size())
+                    {
+                        const std::size_t n = (std::min)(indices.size(), dst.size() - i);
+                        for (std::size_t j = 0; j < n; j++)
+                        {
+                            indices[j] = i + j;
+                        }
+                        fetcher.fetch({ indices.data(), n }, &dst[i], sizeof(Vec4));
+                    }
+                });
+            return AttributeFetcher<TVec>::template createArray<float>(converted.data(), sizeof(Vec4), 4, 1.0f);
+        }
+        return createFetcher<TVec>(type, resolvePointer(buffer, ptr), stride, size, scale);
+    }
+
+    template <typename TVec>
+    static AttributeFetcher<TVec> createFetcher(const Type type, const void* arr, const std::size_t stride, const std::size_t size, const float scale)
+    {
+        switch (type)
+        {
+        case Type::BYTE:
+            return AttributeFetcher<TVec>::template createArray<int8_t>(arr, stride, size, scale);
+        case Type::UNSIGNED_BYTE:
+            return AttributeFetcher<TVec>::template createArray<uint8_t>(arr, stride, size, scale);
+        case Type::SHORT:
+            return AttributeFetcher<TVec>::template createArray<int16_t>(arr, stride, size, scale);
+        case Type::UNSIGNED_SHORT:
+            return AttributeFetcher<TVec>::template createArray<uint16_t>(arr, stride, size, scale);
+        case Type::UNSIGNED_INT:
+            return AttributeFetcher<TVec>::template createArray<int32_t>(arr, stride, size, scale);
+        default:
+            return AttributeFetcher<TVec>::template createArray<float>(arr, stride, size, scale);
+        }
+    }
+
+    template <typename T>
+    static void copyIndices(const T* src, const tcb::span<std::size_t> indices)
+    {
+        for (std::size_t i = 0; i < indices.size(); i++)
+        {
+            indices[i] = src[i];
+        }
+    }
+
     template <typename T>
     T getFromArray(const Type type, const void* arr, const std::size_t stride, std::size_t size, const std::size_t index) const
     {
@@ -161,18 +246,21 @@ private:
     Type m_vertexType;
     std::size_t m_vertexStride;
     const void* m_vertexPointer;
+    BufferObject* m_vertexBuffer { nullptr };
 
     std::bitset<MAX_TMU_COUNT> m_texCoordArrayEnabled;
     std::array<std::size_t, MAX_TMU_COUNT> m_texCoordSize;
     std::array<Type, MAX_TMU_COUNT> m_texCoordType;
     std::array<std::size_t, MAX_TMU_COUNT> m_texCoordStride;
     std::array<const void*, MAX_TMU_COUNT> m_texCoordPointer;
+    std::array<BufferObject*, MAX_TMU_COUNT> m_texCoordBuffer {};
     std::array<Vec4, MAX_TMU_COUNT> m_texCoord {};
 
     bool m_normalArrayEnabled;
     Type m_normalType;
     std::size_t m_normalStride;
     const void* m_normalPointer;
+    BufferObject* m_normalBuffer { nullptr };
     Vec3 m_normal { { 0.0f, 0.0f, 1.0f } };
 
     bool m_colorArrayEnabled;
@@ -180,11 +268,13 @@ private:
     Type m_colorType;
     std::size_t m_colorStride;
     const void* m_colorPointer;
+    BufferObject* m_colorBuffer { nullptr };
     Vec4 m_vertexColor { { 1.0f, 1.0f, 1.0f, 1.0f } };
 
     bool m_indicesEnabled;
     Type m_indicesType;
     const void* m_indicesPointer;
+    BufferObject* m_indicesBuffer { nullptr };
 
     std::size_t m_arrayOffset;
 
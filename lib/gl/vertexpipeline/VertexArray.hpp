@@ -18,6 +18,7 @@
 #ifndef VERTEXARRAY_HPP_
 #define VERTEXARRAY_HPP_
 
+#include "BufferObject.hpp"
 #include "Enums.hpp"
 #include "RenderObj.hpp"
 #include "math/Vec.hpp"
@@ -43,37 +44,92 @@ public:
     void setVertexSize(uint8_t size) { m_objPtr.setVertexSize(size); }
     void setVertexType(Type type) { m_objPtr.setVertexType(type); }
     void setVertexStride(uint32_t stride) { m_objPtr.setVertexStride(stride); }
-    void setVertexPointer(const void* ptr) { m_objPtr.setVertexPointer(ptr); }
+    void setVertexPointer(const void* ptr)
+    {
+        m_objPtr.setVertexPointer(ptr);
+        m_objPtr.setVertexBuffer(m_arrayBuffer);
+    }
 
     void enableTexCoordArray(bool enable) { m_objPtr.enableTexCoordArray(m_tmu, enable); }
     void setTexCoordSize(uint8_t size) { m_objPtr.setTexCoordSize(m_tmu, size); }
     void setTexCoordType(Type type) { m_objPtr.setTexCoordType(m_tmu, type); }
     void setTexCoordStride(uint32_t stride) { m_objPtr.setTexCoordStride(m_tmu, stride); }
-    void setTexCoordPointer(const void* ptr) { m_objPtr.setTexCoordPointer(m_tmu, ptr); }
+    void setTexCoordPointer(const void* ptr)
+    {
+        m_objPtr.setTexCoordPointer(m_tmu, ptr);
+        m_objPtr.setTexCoordBuffer(m_tmu, m_arrayBuffer);
+    }
 
     void enableNormalArray(bool enable) { m_objPtr.enableNormalArray(enable); }
     void setNormalType(Type type) { m_objPtr.setNormalType(type); }
     void setNormalStride(uint32_t stride) { m_objPtr.setNormalStride(stride); }
-    void setNormalPointer(const void* ptr) { m_objPtr.setNormalPointer(ptr); }
+    void setNormalPointer(const void* ptr)
+    {
+        m_objPtr.setNormalPointer(ptr);
+        m_objPtr.setNormalBuffer(m_arrayBuffer);
+    }
 
     void enableColorArray(bool enable) { m_objPtr.enableColorArray(enable); }
     void setColorSize(uint8_t size) { m_objPtr.setColorSize(size); }
     void setColorType(Type type) { m_objPtr.setColorType(type); }
     void setColorStride(uint32_t stride) { m_objPtr.setColorStride(stride); }
-    void setColorPointer(const void* ptr) { m_objPtr.setColorPointer(ptr); }
+    void setColorPointer(const void* ptr)
+    {
+        m_objPtr.setColorPointer(ptr);
+        m_objPtr.setColorBuffer(m_arrayBuffer);
+    }
 
     void setDrawMode(DrawMode mode) { m_objPtr.setDrawMode(mode); }
 
     void enableIndices(bool enable) { m_objPtr.enableIndices(enable); }
     void setCount(std::size_t count) { m_objPtr.setCount(count); }
     void setIndicesType(Type type) { m_objPtr.setIndicesType(type); }
-    void setIndicesPointer(const void* ptr) { m_objPtr.setIndicesPointer(ptr); }
+    void setIndicesPointer(const void* ptr)
+    {
+        m_objPtr.setIndicesPointer(ptr);
+        m_objPtr.setIndicesBuffer(m_elementArrayBuffer);
+    }
     void setArrayOffset(uint32_t offset) { m_objPtr.setArrayOffset(offset); }
 
+    // The array pointers which are set while a buffer is bound are offsets into this buffer
+    void bindArrayBuffer(const uint32_t name, BufferObject* buffer)
+    {
+        m_arrayBufferName = name;
+        m_arrayBuffer = buffer;
+    }
+    void bindElementArrayBuffer(const uint32_t name, BufferObject* buffer)
+    {
+        m_elementArrayBufferName = name;
+        m_elementArrayBuffer = buffer;
+    }
+    uint32_t getArrayBufferName() const { return m_arrayBufferName; }
+    uint32_t getElementArrayBufferName() const { return m_elementArrayBufferName; }
+    BufferObject* getArrayBuffer() const { return m_arrayBuffer; }
+    BufferObject* getElementArrayBuffer() const { return m_elementArrayBuffer; }
+
+    // Resets all bindings to buffer, used when the buffer is deleted
+    void unbindBuffer(const BufferObject* buffer)
+    {
+        if (m_arrayBuffer == buffer)
+        {
+            bindArrayBuffer(0, nullptr);
+        }
+        if (m_elementArrayBuffer == buffer)
+        {
+            bindElementArrayBuffer(0, nullptr);
+        }
+        m_objPtr.unbindBuffer(buffer);
+    }
+
 private:
     // Render Object
     RenderObj m_objPtr {};
     std::size_t m_tmu { 0 };
+
+    uint32_t m_arrayBufferName { 0 };
+    BufferObject* m_arrayBuffer { nullptr };
+    uint32_t m_elementArrayBufferName { 0 };
+    BufferObject* m_elementArrayBuffer { nullptr };
 };
 
 } // namespace rr
@@ -0,0 +1,71 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef VERTEXCACHE_HPP_
+#define VERTEXCACHE_HPP_
+
+#include "RenderConfigs.hpp"
+#include "VertexCacheStatistics.hpp"
+#include "transform/Types.hpp"
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+namespace rr
+{
+
+// Sender side of the post transform vertex cache. It tracks which array index is kept in which entry of the
+// cache of the vertex transformation and tags the vertices accordingly. The cache is direct mapped, the entry
+// is selected by the lower bits of the index. This keeps the lookup at a constant cost, which matters for
+// meshes with little reuse, and the neighbouring indices of a mesh do not evict each other.
+// A hit does not need to be fetched and transformed again, and the threaded rasterization only transfers
+// the tag instead of the attributes.
+class VertexCache
+{
+public:
+    // Invalidates all entries. Required for every draw call, because the keys are only valid for the arrays
+    // and the vertex context of one draw call.
+    void clear() { m_valid.reset(); }
+
+    VertexCacheTag lookup(const uint32_t key)
+    {
+        const std::size_t entry = key & (RenderConfig::VERTEX_CACHE_SIZE - 1);
+        if (m_valid[entry] && (m_keys[entry] == key))
+        {
+            m_statistics.hits++;
+            return { VertexCacheTag::Op::REUSE, static_cast<uint16_t>(entry) };
+        }
+        m_statistics.misses++;
+        m_keys[entry] = key;
+        m_valid.set(entry);
+        return { VertexCacheTag::Op::STORE, static_cast<uint16_t>(entry) };
+    }
+
+    const VertexCacheStatistics& getStatistics() const { return m_statistics; }
+
+private:
+    static_assert((RenderConfig::VERTEX_CACHE_SIZE & (RenderConfig::VERTEX_CACHE_SIZE - 1)) == 0, "The cache size must be a power of two");
+    static_assert(RenderConfig::VERTEX_CACHE_SIZE <= 0x10000, "Entry does not fit into the tag");
+
+    std::array<uint32_t, RenderConfig::VERTEX_CACHE_SIZE> m_keys {};
+    std::bitset<RenderConfig::VERTEX_CACHE_SIZE> m_valid {};
+    VertexCacheStatistics m_statistics {};
+};
+
+} // namespace rr
+#endif // VERTEXCACHE_HPP_
@@ -0,0 +1,35 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _VERTEX_CACHE_STATISTICS_HPP_
+#define _VERTEX_CACHE_STATISTICS_HPP_
+
+#include <cstddef>
+
+namespace rr
+{
+
+// Counters of the post transform vertex cache
+struct VertexCacheStatistics
+{
+    std::size_t hits { 0 }; // Vertices which reused a transformed vertex
+    std::size_t misses { 0 }; // Vertices which were fetched and transformed
+};
+
+} // namespace rr
+
+#endif // _VERTEX_CACHE_STATISTICS_HPP_
@@ -41,18 +41,27 @@ VertexPipeline::VertexPipeline(PixelPipeline& renderer)
     setEnableNormalizing(false);
 }
 
-VertexParameter VertexPipeline::fetch(const RenderObj& obj, std::size_t i)
+void VertexPipeline::fetch(const RenderObj& obj, const AttributeFetchers& fetchers, const tcb::span<const std::size_t> indices, VertexParameter* dst)
 {
-    VertexParameter parameter;
-    const std::size_t pos = obj.getIndex(i);
-    parameter.vertex = obj.getVertex(pos);
-    parameter.normal = obj.getNormal(pos);
-    parameter.color = obj.getColor(pos);
+    // The attributes are fetched one after another for the whole run of vertices
+    constexpr std::size_t stride = sizeof(VertexParameter);
+    if (m_vertexCtx.clipSpaceVertices)
+    {
+        for (std::size_t i = 0; i < indices.size(); i++)
+        {
+            dst[i].vertex = m_compiledVertexArray.getPosition(obj, indices[i]);
+        }
+    }
+    else
+    {
+        fetchers.vertex.fetch(indices, &dst->vertex, stride);
+    }
+    fetchers.color.fetch(indices, &dst->color, stride);
+    fetchers.normal.fetch(indices, &dst->normal, stride);
     for (std::size_t tu = 0; tu < RenderConfig::TMU_COUNT; tu++)
     {
-        parameter.tex[tu] = obj.getTexCoord(tu, pos);
+        fetchers.tex[tu].fetch(indices, &dst->tex[tu], stride);
     }
-    return parameter;
 }
 
 bool VertexPipeline::drawObj(const RenderObj& obj)
@@ -71,28 +80,105 @@ bool VertexPipeline::drawObj(const RenderObj& obj)
     }
     obj.logCurrentConfig();
 
-    m_primitiveAssembler.setDrawMode(obj.getDrawMode());
-    m_primitiveAssembler.setExpectedPrimitiveCount(obj.getCount());
-
+    // These blocks are set on every draw call. They are only marked as dirty when their values have changed.
+    updateVertexCtx(VertexCtx::PRIMITIVE_ASSEMBLER, m_vertexCtx.primitiveAssembler.mode, obj.getDrawMode());
+    updateVertexCtx(VertexCtx::PRIMITIVE_ASSEMBLER, m_vertexCtx.primitiveAssembler.primitiveCount, obj.getCount());
+    std::bitset<RenderConfig::TMU_COUNT> tmuEnabled {};
     for (std::size_t i = 0; i < RenderConfig::TMU_COUNT; i++)
     {
-        m_vertexCtx.tmuEnabled[i] = m_renderer.featureEnable().getEnableTmu(i);
+        tmuEnabled[i] = m_renderer.featureEnable().getEnableTmu(i);
+    }
+    updateVertexCtx(VertexCtx::TMU_ENABLED, m_vertexCtx.tmuEnabled, tmuEnabled);
+    updateVertexCtx(VertexCtx::CLIP_SPACE_VERTICES, m_vertexCtx.clipSpaceVertices, m_compiledVertexArray.prepare(obj, m_vertexCtx));
+    m_renderer.setVertexContext(m_vertexCtx, fetchDirtyVertexCtxBlocks());
+
+    // The fetch kernels are selected once for the whole draw call
+    AttributeFetchers fetchers;
+    fetchers.vertex = obj.getVertexFetcher();
+    fetchers.color = obj.getColorFetcher();
+    fetchers.normal = obj.getNormalFetcher();
+    for (std::size_t tu = 0; tu < RenderConfig::TMU_COUNT; tu++)
+    {
+        fetchers.tex[tu] = obj.getTexCoordFetcher(tu);
     }
-    m_renderer.setVertexContext(m_vertexCtx);
 
+    // The vertices are collected and pushed in batches, which reduces the overhead per vertex of the threaded rasterization
+    std::array<VertexParameter, RenderConfig::THREADED_RASTERIZATION_VERTEX_BATCH_SIZE> batch;
+    std::array<std::size_t, RenderConfig::THREADED_RASTERIZATION_VERTEX_BATCH_SIZE> indices;
     std::size_t count = obj.getCount();
-    for (std::size_t it = 0; it < count; it++)
+    if ((RenderConfig::VERTEX_CACHE_SIZE > 0) && obj.indicesEnabled())
+    {
+        // Indexed meshes reference most of their vertices several times. The cache is keyed by the array index,
+        // therefore a repeated index reuses the transformed vertex instead of fetching and transforming it again.
+        std::array<VertexCacheTag, RenderConfig::THREADED_RASTERIZATION_VERTEX_BATCH_SIZE> tags;
+        m_vertexCache.clear();
+        for (std::size_t it = 0; it < count; it += batch.size())
+        {
+            const std::size_t batchSize = min(batch.size(), count - it);
+            obj.getIndices(it, { indices.data(), batchSize });
+            // Only the misses are fetched. They are packed to the front, the REUSE vertices have no entry in the batch.
+            std::size_t missCount = 0;
+            for (std::size_t i = 0; i < batchSize; i++)
+            {
+                tags[i] = m_vertexCache.lookup(indices[i]);
+                if (tags[i].op != VertexCacheTag::Op::REUSE)
+                {
+                    indices[missCount++] = indices[i];
+                }
+            }
+            fetch(obj, fetchers, { indices.data(), missCount }, batch.data());
+            if (!m_renderer.pushVertices({ batch.data(), missCount }, { tags.data(), batchSize }))
+            {
+                // The STORE vertices of a dropped batch never reach the cache of the vertex transformation,
+                // therefore the following batches must not reuse them.
+                m_vertexCache.clear();
+            }
+        }
+        return true;
+    }
+
+    for (std::size_t it = 0; it < count; it += batch.size())
     {
-        m_renderer.pushVertex(fetch(obj, it));
+        const std::size_t batchSize = min(batch.size(), count - it);
+        obj.getIndices(it, { indices.data(), batchSize });
+        fetch(obj, fetchers, { indices.data(), batchSize }, batch.data());
+        m_renderer.pushVertices({ batch.data(), batchSize });
     }
 
     return true;
 }
 
+void VertexPipeline::snapshotState(StateSnapshot& snapshot) const
+{
+    for (std::size_t block = 0; block < VertexCtx::BLOCK_COUNT; block++)
+    {
+        const tcb::span<const uint8_t> bytes = m_vertexCtx.getBlock(block);
+        snapshot.add(bytes.data(), bytes.size());
+    }
+    m_matrixStore.snapshotState(snapshot);
+    m_lighting.snapshotState(snapshot);
+    m_stencil.snapshotState(snapshot);
+    snapshot.add(m_tmu);
+    m_renderer.snapshotState(snapshot);
+}
+
+VertexPipeline::VertexCtx::DirtyBits VertexPipeline::fetchDirtyVertexCtxBlocks()
+{
+    if constexpr (!RenderConfig::THREADED_RASTERIZATION)
+    {
+        // Only the threaded rasterization transfers the vertex context. The renderer uses it directly.
+        return VertexCtx::DirtyBits {}.set();
+    }
+
+    const VertexCtx::DirtyBits dirty = m_dirtyVertexCtxBlocks;
+    m_dirtyVertexCtxBlocks.reset();
+    return dirty;
+}
+
 bool VertexPipeline::updatePipeline()
 {
     bool ret = m_renderer.updatePipeline();
-    ret = ret && stencil().update();
+    ret = ret && m_stencil.update();
     return ret;
 }
 
@@ -18,7 +18,10 @@
 #ifndef VERTEXPIPELINE_HPP
 #define VERTEXPIPELINE_HPP
 
+#include "AttributeFetcher.hpp"
+#include "CompiledVertexArray.hpp"
 #include "RenderObj.hpp"
+#include "VertexCache.hpp"
 #include "math/Mat44.hpp"
 #include "math/Vec.hpp"
 #include "pixelpipeline/PixelPipeline.hpp"
@@ -43,6 +46,11 @@ public:
     // Drawing
     bool drawObj(const RenderObj& obj);
 
+    // Compiled vertex arrays
+    void lockArrays(const std::size_t first, const std::size_t count, const RenderObj& obj) { m_compiledVertexArray.lock(first, count, obj); }
+    void unlockArrays() { m_compiledVertexArray.unlock(); }
+    const CompiledVertexArray& getCompiledVertexArray() const { return m_compiledVertexArray; }
+
     // Misc
     void activateTmu(const std::size_t tmu)
     {
@@ -63,7 +71,11 @@ public:
     {
         return m_renderer.setScissorBox(x, y, width, height);
     }
-    void setEnableNormalizing(const bool enable) { m_vertexCtx.normalizeLightNormal = enable; }
+    void setEnableNormalizing(const bool enable)
+    {
+        m_vertexCtx.normalizeLightNormal = enable;
+        m_dirtyVertexCtxBlocks.set(VertexCtx::NORMALIZE_LIGHT_NORMAL);
+    }
     void enableVSync(const bool enable) { m_renderer.enableVSync(enable); }
 
     // Framebuffer
@@ -78,22 +90,64 @@ public:
     FeatureEnable& featureEnable() { return m_renderer.featureEnable(); }
 
     // Vertex pipeline configs
-    stencil::StencilSetter& stencil() { return m_stencil; }
-    lighting::LightingSetter& getLighting() { return m_lighting; }
-    texgen::TexGenSetter& getTexGen() { return m_texGen[m_tmu]; }
-    viewport::ViewPortSetter& getViewPort() { return m_viewPort; }
-    matrixstore::MatrixStore& getMatrixStore() { return m_matrixStore; }
-    culling::CullingSetter& getCulling() { return m_culling; }
-    primitiveassembler::PrimitiveAssemblerSetter& getPrimitiveAssembler() { return m_primitiveAssembler; }
+    // The setters are only reachable via these getters. Therefore they mark the block of the vertex context
+    // which the setter changes as dirty. The dirty blocks are transferred with the next draw call.
+    stencil::StencilSetter& stencil() { return markDirty(VertexCtx::STENCIL, m_stencil); }
+    lighting::LightingSetter& getLighting() { return markDirty(VertexCtx::LIGHTING, m_lighting); }
+    texgen::TexGenSetter& getTexGen() { return markDirty(VertexCtx::TEX_GEN, m_texGen[m_tmu]); }
+    viewport::ViewPortSetter& getViewPort() { return markDirty(VertexCtx::VIEW_PORT, m_viewPort); }
+    matrixstore::MatrixStore& getMatrixStore() { return markDirty(VertexCtx::TRANSFORM_MATRICES, m_matrixStore); }
+    culling::CullingSetter& getCulling() { return markDirty(VertexCtx::CULLING, m_culling); }
+    primitiveassembler::PrimitiveAssemblerSetter& getPrimitiveAssembler() { return markDirty(VertexCtx::PRIMITIVE_ASSEMBLER, m_primitiveAssembler); }
+    // Read only access for the queries, which does not mark the block as dirty
+    const matrixstore::MatrixStore& readMatrixStore() const { return m_matrixStore; }
+
+    // Statistics
+    const VertexCacheStatistics& getVertexCacheStatistics() const { return m_vertexCache.getStatistics(); }
+
+    // Adds the state of the vertex and pixel pipeline to the snapshot
+    void snapshotState(StateSnapshot& snapshot) const;
 
 private:
-    void setVertexContext(const vertextransforming::VertexTransformingData& ctx) { m_renderer.setVertexContext(ctx); }
+    using VertexCtx = vertextransforming::VertexTransformingData;
+
+    template <typename TSetter>
+    TSetter& markDirty(const VertexCtx::Block block, TSetter& setter)
+    {
+        m_dirtyVertexCtxBlocks.set(block);
+        return setter;
+    }
+    template <typename T>
+    void updateVertexCtx(const VertexCtx::Block block, T& dst, const T& val)
+    {
+        if (!(dst == val))
+        {
+            dst = val;
+            m_dirtyVertexCtxBlocks.set(block);
+        }
+    }
+    VertexCtx::DirtyBits fetchDirtyVertexCtxBlocks();
     bool pushVertex(VertexParameter& vertex) { return m_renderer.pushVertex(vertex); }
     bool drawTriangle(const primitiveassembler::PrimitiveAssemblerCalc::Triangle& triangle);
-    VertexParameter fetch(const RenderObj& obj, std::size_t i);
+    struct AttributeFetchers
+    {
+        AttributeFetcher<Vec4> vertex;
+        AttributeFetcher<Vec4> color;
+        AttributeFetcher<Vec3> normal;
+        std::array<AttributeFetcher<Vec4>, RenderConfig::TMU_COUNT> tex;
+    };
+    void fetch(const RenderObj& obj, const AttributeFetchers& fetchers, const tcb::span<const std::size_t> indices, VertexParameter* dst);
     bool updatePipeline();
 
-    vertextransforming::VertexTransformingData m_vertexCtx {};
+    VertexCtx m_vertexCtx {};
+
+    // Blocks of the vertex context which have changed since the last draw call
+    VertexCtx::DirtyBits m_dirtyVertexCtxBlocks { VertexCtx::DirtyBits {}.set() };
+
+    // Post transform vertex cache for the indexed draw calls
+    VertexCache m_vertexCache {};
+
+    CompiledVertexArray m_compiledVertexArray {};
 
     // Current active TMU
     std::size_t m_tmu {};
@@ -20,6 +20,7 @@
 
 #include "Enums.hpp"
 #include "RenderObj.hpp"
+#include "StateSnapshot.hpp"
 #include "math/Vec.hpp"
 #include <vector>
 
@@ -88,6 +89,18 @@ public:
 
     const Vec4 color() const { return m_vertexColor; }
 
+    // Adds the current vertex attributes
+    void snapshotState(StateSnapshot& snapshot) const
+    {
+        snapshot.addFloats(m_vertexColor);
+        for (const Vec4& textureCoord : m_textureCoord)
+        {
+            snapshot.addFloats(textureCoord);
+        }
+        snapshot.addFloats(m_normal);
+        snapshot.add(m_tmu);
+    }
+
 private:
     // Buffer
     std::vector<Vec4> m_vertexBuffer;
@@ -17,7 +17,7 @@
 
 #include "glx.h"
 #include "DMAProxyBusConnector.hpp"
-#include "MultiThreadRunner.hpp"
+#include "PersistentThreadRunner.hpp"
 #include "RIXGL.hpp"
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/spdlog.h>
@@ -60,7 +60,7 @@ public:
 
 private:
     rr::DMAProxyBusConnector m_busConnector {};
-    rr::MultiThreadRunner m_runner {};
+    rr::PersistentThreadRunner m_runner {};
 } guard;
 
 GLAPI XVisualInfo* APIENTRY glXChooseVisual(Display* dpy, int screen,
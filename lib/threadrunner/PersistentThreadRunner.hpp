@@ -0,0 +1,203 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef PERSISTENTTHREADRUNNER_HPP
+#define PERSISTENTTHREADRUNNER_HPP
+
+#include "IThreadRunner.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace rr
+{
+
+// Runner with one long-lived worker thread. Other than the MultiThreadRunner, it does not create a new thread
+// for every operation. The operation is handed over through a slot. The worker and wait() are spinning a short
+// time for the slot to change, before they are blocking. For several workers, use several runners.
+class PersistentThreadRunner : public IThreadRunner
+{
+    using Clock = std::chrono::steady_clock;
+
+public:
+    // Counters of the runner. All times are in nanoseconds.
+    struct Statistics
+    {
+        std::size_t runs { 0 };
+        uint64_t totalHandoffLatency { 0 }; // Time from run() till the worker starts the operation
+        uint64_t maxHandoffLatency { 0 };
+        uint64_t totalRunTime { 0 }; // Time the worker spent executing the operations
+        std::size_t workerWakeups { 0 }; // How often the worker was blocked and had to be woken up
+        std::size_t blockingWaits { 0 }; // How often wait() was blocked
+    };
+
+    // core: The core the worker is pinned to, -1 for no pinning.
+    // spinCount: How often the slot is polled before blocking.
+    PersistentThreadRunner(const int core = -1, const std::size_t spinCount = 1000)
+        : m_spinCount { spinCount }
+    {
+        m_worker = std::thread { [this]()
+            { work(); } };
+        setCore(core);
+    }
+
+    ~PersistentThreadRunner()
+    {
+        wait();
+        m_slot.store(Slot::STOP);
+        notify();
+        m_worker.join();
+    }
+
+    // Pins the worker to a core. Returns false if the pinning is not supported or failed.
+    bool setCore(const int core)
+    {
+        if (core < 0)
+        {
+            return true;
+        }
+#if defined(__linux__)
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(core, &cpuSet);
+        return pthread_setaffinity_np(m_worker.native_handle(), sizeof(cpu_set_t), &cpuSet) == 0;
+#else
+        return false;
+#endif
+    }
+
+    void wait() override
+    {
+        if (!spinThenBlock([this]()
+                { return m_slot.load() == Slot::IDLE; }))
+        {
+            m_statistics.blockingWaits++;
+        }
+    }
+
+    void run(const std::function<bool()>& operation) override
+    {
+        wait();
+        m_operation = operation;
+        m_runTime = Clock::now();
+        m_slot.store(Slot::PENDING);
+        notify();
+    }
+
+    // Must only be called when no operation is running
+    Statistics getStatistics() const
+    {
+        return m_statistics;
+    }
+
+private:
+    enum class Slot
+    {
+        IDLE,
+        PENDING,
+        STOP
+    };
+
+    void work()
+    {
+        while (true)
+        {
+            const bool woken = !spinThenBlock([this]()
+                { return m_slot.load() != Slot::IDLE; });
+            if (m_slot.load() == Slot::STOP)
+            {
+                return;
+            }
+            const Clock::time_point start = Clock::now();
+            const uint64_t latency = toNs(start - m_runTime);
+            m_operation();
+            m_statistics.runs++;
+            m_statistics.totalHandoffLatency += latency;
+            m_statistics.maxHandoffLatency = (std::max)(m_statistics.maxHandoffLatency, latency);
+            m_statistics.totalRunTime += toNs(Clock::now() - start);
+            m_statistics.workerWakeups += woken ? 1 : 0;
+            m_slot.store(Slot::IDLE);
+            notify();
+        }
+    }
+
+    static uint64_t toNs(const Clock::duration duration)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    }
+
+    // Returns true if the condition became true while spinning, false if it was required to block.
+    // Spinning yields, therefore it also works when the threads share one core.
+    template <typename Pred>
+    bool spinThenBlock(const Pred& pred)
+    {
+        for (std::size_t i = 0; !pred(); i++)
+        {
+            if (i >= m_spinCount)
+            {
+                return block(pred);
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+
+    template <typename Pred>
+    bool block(const Pred& pred)
+    {
+        // The waiter announces itself before it checks the condition under the lock. The notifier changes
+        // the slot before it checks for waiters. Therefore, the wake up can't get lost.
+        std::unique_lock<std::mutex> lock { m_mutex };
+        m_waiters.fetch_add(1);
+        m_condition.wait(lock, pred);
+        m_waiters.fetch_sub(1);
+        return false;
+    }
+
+    void notify()
+    {
+        if (m_waiters.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock { m_mutex };
+            m_condition.notify_all();
+        }
+    }
+
+    const std::size_t m_spinCount;
+    std::function<bool()> m_operation {};
+    Clock::time_point m_runTime {};
+    std::atomic<Slot> m_slot { Slot::IDLE };
+    Statistics m_statistics {};
+
+    std::mutex m_mutex {};
+    std::condition_variable m_condition {};
+    std::atomic<std::size_t> m_waiters { 0 };
+    std::thread m_worker {};
+};
+
+} // namespace rr
+
+#endif // PERSISTENTTHREADRUNNER_HPP
@@ -0,0 +1,551 @@
+// RasterIX
+// https://github.com/ToNi3141/RasterIX
+// Copyright (c) 2025 ToNi3141
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include "IThreadRunner.hpp"
+#include "ITaskPool.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace rr
+{
+
+// Work-stealing pool with a fixed number of worker threads. Every worker owns a queue. A worker executes the
+// tasks of its own queue from the back (the most recently forked task first) and steals from the front of the
+// other queues when its own queue is empty. Tasks submitted by other threads are placed in an extra queue.
+// The tasks are stored in the queues by value, therefore a task does not allocate memory. When a queue is full,
+// the task is executed by the submitting thread.
+// A thread which waits for its tasks (parallelFor() or a TaskGroup) helps executing the queued tasks.
+// Runners (see createRunner()) make the pool usable where the driver expects an IThreadRunner. The operation
+// of a runner occupies a worker till it returns. It is never executed by a helping thread or by the submitting
+// thread, because it can wait for the submitting thread. Therefore, every runner reserves a worker, and the pool
+// needs one worker for every long running operation (like a rasterizer or front end thread) plus the workers for
+// the fine-grained tasks.
+class ThreadPool : public ITaskPool
+{
+public:
+    static constexpr std::size_t QUEUE_SIZE { 256 };
+
+    // Counters of a worker. Can be read while the pool is running.
+    struct WorkerStatistics
+    {
+        std::size_t executed { 0 }; // Executed tasks
+        std::size_t stolen { 0 }; // Tasks which were taken from the queue of another worker or the submission queue
+        std::size_t sleeps { 0 }; // How often the worker was blocked because there was no work
+    };
+
+    // Joins a set of tasks. The group must outlive its tasks.
+    class TaskGroup
+    {
+    public:
+        TaskGroup(ThreadPool& pool)
+            : m_pool { pool }
+        {
+        }
+
+        ~TaskGroup()
+        {
+            wait();
+        }
+
+        // Queues the task. Function must be callable as void().
+        template <typename Function>
+        void run(Function& function)
+        {
+            m_pool.submit({ &invoke<Function>, &function, 0, 0, &m_pending, true });
+        }
+
+        // Waits till all tasks of this group are executed and helps executing queued tasks in the meantime
+        void wait()
+        {
+            m_pool.join(m_pending);
+        }
+
+    private:
+        template <typename Function>
+        static void invoke(void* function, std::size_t, std::size_t)
+        {
+            (*static_cast<Function*>(function))();
+        }
+
+        ThreadPool& m_pool;
+        std::atomic<std::size_t> m_pending { 0 };
+    };
+
+    // Executes one operation at a time in a worker of the pool. Created with createRunner().
+    class Runner : public IThreadRunner
+    {
+    public:
+        ~Runner()
+        {
+            wait();
+            m_pool.m_runners.fetch_sub(1);
+        }
+
+        void wait() override
+        {
+            // Helping is not possible, because a helper could pick up an operation which waits for the caller
+            m_pool.block(m_pending);
+        }
+
+        void run(const std::function<bool()>& operation) override
+        {
+            wait();
+            m_operation = operation;
+            m_pool.submit({ &invoke, this, 0, 0, &m_pending, false });
+        }
+
+    private:
+        friend class ThreadPool;
+
+        Runner(ThreadPool& pool)
+            : m_pool { pool }
+        {
+        }
+
+        static void invoke(void* runner, std::size_t, std::size_t)
+        {
+            static_cast<Runner*>(runner)->m_operation();
+        }
+
+        ThreadPool& m_pool;
+        std::function<bool()> m_operation {};
+        std::atomic<std::size_t> m_pending { 0 };
+    };
+
+    // workers: Number of worker threads. Zero executes all tasks in the calling thread and allows no runners.
+    // firstCore: Worker i is pinned to the core firstCore + i, -1 for no pinning.
+    // spinCount: How often the queues are polled before a thread is blocking.
+    ThreadPool(const std::size_t workers, const int firstCore = -1, const std::size_t spinCount = 1000)
+        : m_spinCount { spinCount }
+        , m_queues(workers + 2)
+        , m_statistics(workers)
+    {
+        m_workers.reserve(workers);
+        for (std::size_t i = 0; i < workers; i++)
+        {
+            m_workers.emplace_back([this, i]()
+                { work(i); });
+            if (firstCore >= 0)
+            {
+                setCore(i, firstCore + static_cast<int>(i));
+            }
+        }
+    }
+
+    ~ThreadPool()
+    {
+        m_stop.store(true);
+        {
+            std::lock_guard<std::mutex> lock { m_workerMutex };
+            m_workerCondition.notify_all();
+        }
+        for (std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    // Pins a worker to a core. Returns false if the pinning is not supported or failed.
+    bool setCore(const std::size_t worker, const int core)
+    {
+        if ((core < 0) || (worker >= m_workers.size()))
+        {
+            return false;
+        }
+#if defined(__linux__)
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(core, &cpuSet);
+        return pthread_setaffinity_np(m_workers[worker].native_handle(), sizeof(cpu_set_t), &cpuSet) == 0;
+#else
+        return false;
+#endif
+    }
+
+    std::size_t getWorkerCount() const
+    {
+        return m_workers.size();
+    }
+
+    WorkerStatistics getStatistics(const std::size_t worker) const
+    {
+        const Statistics& statistics = m_statistics[worker];
+        return {
+            statistics.executed.load(std::memory_order_relaxed),
+            statistics.stolen.load(std::memory_order_relaxed),
+            statistics.sleeps.load(std::memory_order_relaxed),
+        };
+    }
+
+    // Tasks which were executed by threads which are not part of the pool, while they were waiting for their tasks
+    std::size_t getHelpedTasks() const
+    {
+        return m_helped.load(std::memory_order_relaxed);
+    }
+
+    // Tasks which were executed by the submitting thread, because the queue was full
+    std::size_t getOverflowedTasks() const
+    {
+        return m_overflowed.load(std::memory_order_relaxed);
+    }
+
+    void parallelFor(const std::size_t count, const std::size_t grain, const std::function<void(std::size_t begin, std::size_t end)>& task) override
+    {
+        const std::size_t chunkSize = (std::max)(grain, static_cast<std::size_t>(1));
+        const std::size_t chunks = (count + chunkSize - 1) / chunkSize;
+        if ((chunks <= 1) || m_workers.empty())
+        {
+            if (count > 0)
+            {
+                task(0, count);
+            }
+            return;
+        }
+        // Forks all chunks but the first, which is executed by the calling thread
+        std::atomic<std::size_t> pending { 0 };
+        for (std::size_t i = chunks - 1; i > 0; i--)
+        {
+            submit({ &invokeRange, const_cast<void*>(static_cast<const void*>(&task)), i * chunkSize, (std::min)((i + 1) * chunkSize, count), &pending, true });
+        }
+        task(0, chunkSize);
+        join(pending);
+    }
+
+    // Creates a runner which executes its operations in this pool. The runner reserves a worker till it is
+    // destroyed. Returns nullptr if all workers are already reserved by other runners.
+    std::unique_ptr<Runner> createRunner()
+    {
+        std::size_t runners = m_runners.load();
+        do
+        {
+            if (runners >= (std::min)(m_workers.size(), QUEUE_SIZE))
+            {
+                return nullptr;
+            }
+        } while (!m_runners.compare_exchange_weak(runners, runners + 1));
+        return std::unique_ptr<Runner>(new Runner(*this));
+    }
+
+private:
+    struct Task
+    {
+        void (*execute)(void* context, std::size_t begin, std::size_t end);
+        void* context;
+        std::size_t begin;
+        std::size_t end;
+        std::atomic<std::size_t>* pending; // Counter of the unfinished tasks of the group of this task
+        bool helpable; // The task is short and can be executed by a thread which waits for its own tasks or by the submitting thread
+    };
+
+    // Bounded deque. The owner pushes and pops at the back, the thieves take from the front.
+    struct Queue
+    {
+        std::mutex mutex {};
+        std::array<Task, QUEUE_SIZE> tasks {};
+        std::size_t front { 0 };
+        std::size_t back { 0 };
+
+        bool push(const Task& task)
+        {
+            std::lock_guard<std::mutex> lock { mutex };
+            if ((back - front) == QUEUE_SIZE)
+            {
+                return false;
+            }
+            tasks[back % QUEUE_SIZE] = task;
+            back++;
+            return true;
+        }
+
+        bool popBack(Task& task, const bool helpableOnly)
+        {
+            std::lock_guard<std::mutex> lock { mutex };
+            for (std::size_t i = back; i != front; i--)
+            {
+                if (!helpableOnly || tasks[(i - 1) % QUEUE_SIZE].helpable)
+                {
+                    task = tasks[(i - 1) % QUEUE_SIZE];
+                    tasks[(i - 1) % QUEUE_SIZE] = tasks[(back - 1) % QUEUE_SIZE];
+                    back--;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool popFront(Task& task, const bool helpableOnly)
+        {
+            std::lock_guard<std::mutex> lock { mutex };
+            for (std::size_t i = front; i != back; i++)
+            {
+                if (!helpableOnly || tasks[i % QUEUE_SIZE].helpable)
+                {
+                    task = tasks[i % QUEUE_SIZE];
+                    tasks[i % QUEUE_SIZE] = tasks[front % QUEUE_SIZE];
+                    front++;
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
+    struct Statistics
+    {
+        std::atomic<std::size_t> executed { 0 };
+        std::atomic<std::size_t> stolen { 0 };
+        std::atomic<std::size_t> sleeps { 0 };
+    };
+
+    // The worker which is running in this thread
+    struct WorkerContext
+    {
+        const ThreadPool* pool { nullptr };
+        std::size_t index { 0 };
+    };
+
+    static WorkerContext& currentWorker()
+    {
+        static thread_local WorkerContext context {};
+        return context;
+    }
+
+    static void invokeRange(void* task, const std::size_t begin, const std::size_t end)
+    {
+        (*static_cast<const std::function<void(std::size_t, std::size_t)>*>(task))(begin, end);
+    }
+
+    std::size_t getSubmissionQueue() const
+    {
+        return m_workers.size();
+    }
+
+    // Queue of the runner operations. It has always space, because every runner has at most one queued
+    // operation and there are not more runners than the queue size.
+    std::size_t getRunnerQueue() const
+    {
+        return m_workers.size() + 1;
+    }
+
+    // Returns the queue of the calling worker or the submission queue for other threads
+    std::size_t getOwnQueue() const
+    {
+        const WorkerContext& context = currentWorker();
+        return (context.pool == this) ? context.index : getSubmissionQueue();
+    }
+
+    void submit(const Task& task)
+    {
+        task.pending->fetch_add(1);
+        if (!task.helpable)
+        {
+            m_queues[getRunnerQueue()].push(task);
+        }
+        else if (m_workers.empty() || !m_queues[getOwnQueue()].push(task))
+        {
+            m_overflowed.fetch_add(1, std::memory_order_relaxed);
+            execute(task);
+            return;
+        }
+        m_queued.fetch_add(1);
+        notifyWorkers();
+    }
+
+    void execute(const Task& task)
+    {
+        task.execute(task.context, task.begin, task.end);
+        if (task.pending->fetch_sub(1) == 1)
+        {
+            notifyJoiners();
+        }
+    }
+
+    // Takes a task from the back of the own queue or steals one from the front of the other queues, starting
+    // after the own queue. Threads which are not part of the pool own the submission queue together.
+    bool take(Task& task, const std::size_t own, const bool helpableOnly, bool& stolen)
+    {
+        if (m_queued.load() == 0)
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < m_queues.size(); i++)
+        {
+            const std::size_t victim = (own + i) % m_queues.size();
+            const bool owner = (victim == own) && (own != getSubmissionQueue());
+            if (owner ? m_queues[victim].popBack(task, helpableOnly) : m_queues[victim].popFront(task, helpableOnly))
+            {
+                m_queued.fetch_sub(1);
+                stolen = !owner;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void work(const std::size_t index)
+    {
+        currentWorker() = { this, index };
+        Statistics& statistics = m_statistics[index];
+        while (!m_stop.load())
+        {
+            Task task;
+            bool stolen = false;
+            bool found = false;
+            for (std::size_t i = 0; !found && (i < m_spinCount) && !m_stop.load(); i++)
+            {
+                found = take(task, index, false, stolen);
+                if (!found)
+                {
+                    std::this_thread::yield();
+                }
+            }
+            if (found)
+            {
+                execute(task);
+                statistics.executed.fetch_add(1, std::memory_order_relaxed);
+                statistics.stolen.fetch_add(stolen ? 1 : 0, std::memory_order_relaxed);
+            }
+            else if (!m_stop.load())
+            {
+                statistics.sleeps.fetch_add(1, std::memory_order_relaxed);
+                blockWorker();
+            }
+        }
+    }
+
+    // Executes queued tasks till all tasks of the group are finished
+    void join(const std::atomic<std::size_t>& pending)
+    {
+        const std::size_t own = getOwnQueue();
+        const bool worker = own != getSubmissionQueue();
+        while (pending.load() != 0)
+        {
+            Task task;
+            bool stolen = false;
+            bool found = false;
+            for (std::size_t i = 0; !found && (i < m_spinCount) && (pending.load() != 0); i++)
+            {
+                found = take(task, own, true, stolen);
+                if (!found)
+                {
+                    std::this_thread::yield();
+                }
+            }
+            if (found)
+            {
+                execute(task);
+                if (worker)
+                {
+                    m_statistics[own].executed.fetch_add(1, std::memory_order_relaxed);
+                    m_statistics[own].stolen.fetch_add(stolen ? 1 : 0, std::memory_order_relaxed);
+                }
+                else
+                {
+                    m_helped.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                // The remaining tasks of the group are running in other threads
+                block(pending);
+            }
+        }
+    }
+
+    // The waiters announce themselves before they check the condition under the lock. The notifiers change
+    // the condition before they check for waiters. Therefore, a wake up can't get lost.
+    void blockWorker()
+    {
+        std::unique_lock<std::mutex> lock { m_workerMutex };
+        m_sleepingWorkers.fetch_add(1);
+        m_workerCondition.wait(lock, [this]()
+            { return (m_queued.load() != 0) || m_stop.load(); });
+        m_sleepingWorkers.fetch_sub(1);
+    }
+
+    void notifyWorkers()
+    {
+        if (m_sleepingWorkers.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock { m_workerMutex };
+            m_workerCondition.notify_one();
+        }
+    }
+
+    void block(const std::atomic<std::size_t>& pending)
+    {
+        for (std::size_t i = 0; pending.load() != 0; i++)
+        {
+            if (i >= m_spinCount)
+            {
+                std::unique_lock<std::mutex> lock { m_joinMutex };
+                m_joiners.fetch_add(1);
+                m_joinCondition.wait(lock, [&pending]()
+                    { return pending.load() == 0; });
+                m_joiners.fetch_sub(1);
+                return;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    void notifyJoiners()
+    {
+        if (m_joiners.load() > 0)
+        {
+            std::lock_guard<std::mutex> lock { m_joinMutex };
+            m_joinCondition.notify_all();
+        }
+    }
+
+    const std::size_t m_spinCount;
+    std::vector<Queue> m_queues;
+    std::vector<Statistics> m_statistics;
+    std::vector<std::thread> m_workers {};
+    std::atomic<std::size_t> m_queued { 0 };
+    std::atomic<bool> m_stop { false };
+    std::atomic<std::size_t> m_helped { 0 };
+    std::atomic<std::size_t> m_overflowed { 0 };
+    std::atomic<std::size_t> m_runners { 0 };
+
+    std::mutex m_workerMutex {};
+    std::condition_variable m_workerCondition {};
+    std::atomic<std::size_t> m_sleepingWorkers { 0 };
+
+    std::mutex m_joinMutex {};
+    std::condition_variable m_joinCondition {};
+    std::atomic<std::size_t> m_joiners { 0 };
+};
+
+} // namespace rr
+
+#endif // THREADPOOL_HPP